@@ -2667,6 +2667,15 @@ void RewriteInstance::readRelocations(const SectionRef &Section) {
   }
 }
 
+// Deciding which functions get the full treatment is also where a future
+// incremental mode would plug in: re-optimizing a nightly build where most
+// functions' bytes match yesterday's input could skip them by keying on
+// (raw bytes, profile shape). Skipping is the easy half, though. Emitted
+// code for cached functions would have to be replayed with every external
+// reference re-resolved against today's layout, and fragments, jump tables
+// and CFI are only discovered during disassembly, so a cache needs its own
+// serialized form of those as well. Until such a format exists, lite mode
+// below is the supported way to limit processing to profiled functions.
 void RewriteInstance::selectFunctionsToProcess() {
   // Extend the list of functions to process or skip from a file.
   auto populateFunctionNames = [](cl::opt<std::string> &FunctionNamesFile,
@@ -2852,6 +2861,13 @@ void RewriteInstance::processProfileData() {
 void RewriteInstance::disassembleFunctions() {
   NamedRegionTimer T("disassembleFunctions", "disassemble functions",
                      TimerGroupName, TimerGroupDesc, opts::TimeRewrite);
+  // Unlike CFG construction below, disassembly stays sequential even though
+  // each function decodes independently: disassemble() creates global
+  // symbols, registers interprocedural references and populates shared jump
+  // table state through BinaryContext interfaces that are not synchronized
+  // (getOrCreateGlobalSymbol, addInterproceduralReference,
+  // populateJumpTables input). Sharding this loop over the thread pool first
+  // requires those interfaces to take the same locks buildCFG relies on.
   for (auto &BFI : BC->getBinaryFunctions()) {
     BinaryFunction &Function = BFI.second;
 
@@ -600,6 +600,13 @@ void escapeBackslashAndQuotes(llvm::StringRef Text, llvm::raw_ostream &OS) {
   }
 }
 
+// Patching covers edits to the main file's preamble region only. Edits to
+// the *headers* the preamble includes always invalidate it, even when they
+// only touch comments or function bodies: the baked PCH serializes byte
+// offsets into those headers (SourceLocations, macro expansion ranges), so
+// reusing it against shifted contents would mislocate every diagnostic and
+// index result, and proving an edit interface-neutral would itself require
+// reparsing the header — most of the cost a rebuild pays anyway.
 PreamblePatch PreamblePatch::create(llvm::StringRef FileName,
                                     const ParseInputs &Modified,
                                     const PreambleData &Baseline,
@@ -11,8 +11,11 @@
 #include "index/Background.h"
 #include "support/Logger.h"
 #include "support/Path.h"
+#include "support/Threading.h"
 #include "llvm/ADT/StringMap.h"
+#include "llvm/ADT/StringSet.h"
 #include "llvm/Support/Path.h"
+#include "llvm/Support/Threading.h"
 #include <string>
 #include <utility>
 #include <vector>
@@ -120,12 +123,45 @@ std::vector<LoadedShard>
 loadIndexShards(llvm::ArrayRef<Path> MainFiles,
                 BackgroundIndexStorage::Factory &IndexStorageFactory,
                 const GlobalCompilationDatabase &CDB) {
-  BackgroundIndexLoader Loader(IndexStorageFactory);
-  for (llvm::StringRef MainFile : MainFiles) {
-    assert(llvm::sys::path::is_absolute(MainFile));
-    Loader.load(MainFile);
+  // Loading is dominated by reading and parsing the per-file RIFF shards,
+  // which are independent of each other, so spread the main files over
+  // several loaders running in parallel. Each loader deduplicates the header
+  // shards reachable from its own main files; a header shared between main
+  // files assigned to different workers may be read twice, and the merge
+  // below keeps the first copy. The storage factory and compilation database
+  // are internally synchronized.
+  unsigned Workers = std::min<size_t>(
+      MainFiles.size(), llvm::hardware_concurrency().compute_thread_count());
+  if (Workers <= 1) {
+    BackgroundIndexLoader Loader(IndexStorageFactory);
+    for (llvm::StringRef MainFile : MainFiles) {
+      assert(llvm::sys::path::is_absolute(MainFile));
+      Loader.load(MainFile);
+    }
+    return std::move(Loader).takeResult();
+  }
+
+  std::vector<std::vector<LoadedShard>> Chunks(Workers);
+  AsyncTaskRunner Tasks;
+  for (unsigned W = 0; W < Workers; ++W) {
+    Tasks.runAsync("load-shards:" + llvm::Twine(W), [&, W] {
+      BackgroundIndexLoader Loader(IndexStorageFactory);
+      for (size_t I = W; I < MainFiles.size(); I += Workers) {
+        assert(llvm::sys::path::is_absolute(MainFiles[I]));
+        Loader.load(MainFiles[I]);
+      }
+      Chunks[W] = std::move(Loader).takeResult();
+    });
   }
-  return std::move(Loader).takeResult();
+  Tasks.wait();
+
+  std::vector<LoadedShard> Result;
+  llvm::StringSet<> Seen;
+  for (auto &Chunk : Chunks)
+    for (auto &LS : Chunk)
+      if (Seen.insert(LS.AbsolutePath).second)
+        Result.push_back(std::move(LS));
+  return Result;
 }
 
 } // namespace clangd
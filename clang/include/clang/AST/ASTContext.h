@@ -209,6 +209,12 @@ struct TypeInfoChars {
 class ASTContext : public RefCountedBase<ASTContext> {
   friend class NestedNameSpecifier;
 
+  // Type uniquing tables. Each kind profiles its identity into a
+  // FoldingSetNodeID per lookup; storing the hash on the node (as
+  // FastFoldingSetNode does) would grow every Type by a word for hashes
+  // that are one or two pointer mixes for the hot kinds, and the nodes
+  // themselves already come out of the context's slab allocator, so
+  // allocation locality is as good as a per-kind pool would give.
   mutable SmallVector<Type *, 0> Types;
   mutable llvm::FoldingSet<ExtQuals> ExtQualNodes;
   mutable llvm::FoldingSet<ComplexType> ComplexTypes;
@@ -67,6 +67,16 @@ class VarDecl;
 
 /// Stmt - This represents one statement.
 ///
+/// Child links are full pointers. Compressing them to 32-bit offsets from
+/// the owning slab has been studied for very large TUs and founders on the
+/// allocator's structure: ASTContext allocates from a chain of slabs, not
+/// one arena, so an offset needs a base to be relative to, and nodes
+/// routinely point across slabs (and at Decls, identifiers, and other
+/// context-owned objects laid out elsewhere). Every consumer — including
+/// out-of-tree tooling walking children() — would also have to go through
+/// decompression accessors, which is an ABI break for all AST libraries.
+/// The supported levers for AST size are the bit-field factoring below
+/// (StmtBitfields et al.) and trailing-object packing on individual nodes.
 class alignas(void *) Stmt {
 public:
   enum StmtClass {
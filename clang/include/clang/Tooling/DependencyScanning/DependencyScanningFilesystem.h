@@ -148,6 +148,15 @@ private:
 ///
 /// It is sharded based on the hash of the key to reduce the lock contention for
 /// the worker threads.
+///
+/// The directive-token stream cached here is the deepest per-file result
+/// that can be shared across scans: which of those directives fire -- and
+/// therefore a file's dependency edges -- depends on the macro and include
+/// state of each inclusion point, so scans still replay the (cheap) cached
+/// directives through the preprocessor. Memoizing edges keyed by a hash of
+/// the incoming macro state would not pay for itself, as identifying the
+/// subset of the state a file is sensitive to requires the same walk over
+/// its directives that the replay performs.
 class DependencyScanningFilesystemSharedCache {
 public:
   struct CacheShard {
@@ -11,6 +11,19 @@
 // The execution context manages cached bytecode and the global context.
 // It invokes the compiler and interpreter, propagating errors.
 //
+// The interpreter is gated behind -fexperimental-new-constant-interpreter
+// and deliberately bails out to the tree-walking evaluator in ExprConstant
+// for anything it cannot yet compile (see InterpGen's error paths), so
+// enabling it early is safe but only accelerates what it covers. Coverage
+// grows opcode by opcode; flipping the default has to wait until the bailout
+// rate on real constexpr-heavy code is negligible, since a failed compile
+// costs a wasted bytecode-generation pass before the old evaluator reruns
+// the evaluation. A JIT tier below this interface has been considered and
+// rejected for now: constant evaluation must track full interpreter state
+// (frames, lifetimes, diagnostics pointing back at the AST) to reject
+// undefined behaviour, and lowering that bookkeeping to native code gives
+// up exactly the checking that makes the result a constant expression.
+//
 //===----------------------------------------------------------------------===//
 
 #ifndef LLVM_CLANG_AST_INTERP_CONTEXT_H
@@ -1024,6 +1024,17 @@ private:
     }
   }
 
+  // Decl/Stmt matchers (the bulk of any clang-tidy load) are pre-bucketed by
+  // node kind: getFilterForKind keeps, per ASTNodeKind, only the indices of
+  // matchers whose outermost restriction can accept that kind, so the loop
+  // below scales with matchers that can plausibly fire on this node rather
+  // than with everything registered. Merging matchers further — a decision
+  // tree sharing common prefixes across rules — isn't reachable from here:
+  // past the kind restriction a DynTypedMatcher is an opaque composition of
+  // singleton matcher objects with no structure left to compare or merge, and
+  // the memoization cache is keyed on matcher instance identity, so equal
+  // sub-matchers written in different rules are distinct entries by design
+  // (their bound-nodes sets differ).
   void matchWithFilter(const DynTypedNode &DynNode) {
     auto Kind = DynNode.getNodeKind();
     auto it = MatcherFiltersMap.find(Kind);
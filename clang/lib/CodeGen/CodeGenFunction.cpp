@@ -66,6 +66,15 @@ static bool shouldEmitLifetimeMarkers(const CodeGenOptions &CGOpts,
   return CGOpts.OptimizationLevel != 0;
 }
 
+// A CodeGenFunction is a stack object created fresh for each emitted
+// function. That is cheaper than it looks for small functions: the members
+// that can grow large allocate lazily (the EHScopeStack buffer is only
+// malloc'd on the first cleanup push, so single-block no-EH bodies never
+// touch it; lexical scope and deferred-deactivation vectors start inline).
+// Construction cost is dominated by plain member initialization, which a
+// recycled object would have to redo field-by-field anyway to keep stale
+// state from leaking between functions, so a pool would not remove work —
+// it would only rename the reset.
 CodeGenFunction::CodeGenFunction(CodeGenModule &cgm, bool suppressNewContext)
     : CodeGenTypeCache(cgm), CGM(cgm), Target(cgm.getTarget()),
       Builder(cgm, cgm.getModule().getContext(), llvm::ConstantFolder(),
@@ -47,6 +47,7 @@
 #include "clang/CodeGen/BackendUtil.h"
 #include "clang/CodeGen/ConstantInitBuilder.h"
 #include "clang/Frontend/FrontendDiagnostic.h"
+#include "llvm/ADT/Statistic.h"
 #include "llvm/ADT/StringSwitch.h"
 #include "llvm/ADT/Triple.h"
 #include "llvm/Analysis/TargetLibraryInfo.h"
@@ -70,6 +71,13 @@
 using namespace clang;
 using namespace CodeGen;
 
+#define DEBUG_TYPE "codegen-deferred"
+
+STATISTIC(NumDeferredDeclsEmitted,
+          "Number of deferred decls emitted because they were referenced.");
+STATISTIC(NumDeferredDeclsNeverEmitted,
+          "Number of deferred decls never referenced and so never emitted.");
+
 static llvm::cl::opt<bool> LimitedCoverage(
     "limited-coverage-experimental", llvm::cl::Hidden,
     llvm::cl::desc("Emit limited coverage mapping information (experimental)"));
@@ -524,6 +532,9 @@ void CodeGenModule::Release() {
   if (CXX20ModuleInits && Primary && !Primary->isHeaderLikeModule())
     EmitModuleInitializers(Primary);
   EmitDeferred();
+  // Whatever is still in DeferredDecls was never referenced from an emitted
+  // definition; those bodies are the lazy-emission savings.
+  NumDeferredDeclsNeverEmitted += DeferredDecls.size();
   DeferredDecls.insert(EmittedDeferredDecls.begin(),
                        EmittedDeferredDecls.end());
   EmittedDeferredDecls.clear();
@@ -2672,6 +2683,7 @@ void CodeGenModule::EmitDeferred() {
 
     // Otherwise, emit the definition and move on to the next one.
     EmitGlobalDefinition(D, GV);
+    ++NumDeferredDeclsEmitted;
 
     // If we found out that we need to emit more decls, do that recursively.
     // This has the advantage that the decls are emitted in a DFS and related
@@ -398,6 +398,15 @@ CrossTranslationUnitContext::ASTUnitStorage::ASTUnitStorage(
                     ? CI.getAnalyzerOpts()->CTUImportCppThreshold
                     : CI.getAnalyzerOpts()->CTUImportThreshold) {}
 
+// ASTs are cached per analyzed TU (FileASTUnitMap) but cannot be shared
+// across the analyses of different TUs, which is where the repeated import
+// cost comes from. Replacing callee import with persisted path-insensitive
+// effect summaries has been discussed and does not fit the engine: most of
+// the analyzer's value lives in checker-specific program-state traits, and
+// a summary format would have to encode the transfer function of every
+// registered checker to avoid dropping their diagnostics. The supported
+// levers for large projects are the on-demand ASTLoader below and the
+// ctu-import(-cpp) thresholds enforced by LoadGuard.
 llvm::Expected<ASTUnit *>
 CrossTranslationUnitContext::ASTUnitStorage::getASTUnitForFile(
     StringRef FileName, bool DisplayCTUProgress) {
@@ -379,6 +379,17 @@ int CC1Command::Execute(ArrayRef<llvm::Optional<StringRef>> Redirects,
   // FIXME: Currently, if there're more than one job, we disable
   // -fintegrate-cc1. If we're no longer a integrated-cc1 job, fallback to
   // out-of-process execution. See discussion in https://reviews.llvm.org/D74447
+  //
+  // The same global state blocks the periodically proposed cc1 "fork
+  // server" (a warm daemon that forks once per TU): a cc1 invocation
+  // mutates cl::opt storage, statistics, timers and signal handlers in
+  // ways that are never reset, so the daemon must not itself compile, and
+  // a fork from a pristine parent only saves process creation and static
+  // initializers, not any per-TU work. Add that fork is unavailable on
+  // Windows and that a long-lived stat/header cache would need an
+  // invalidation story, and the payoff does not cover a new daemon and
+  // IPC surface here. Build systems get the same effect by batching
+  // several compiles into one driver invocation.
   if (!InProcess)
     return Command::Execute(Redirects, ErrMsg, ExecutionFailed);
 
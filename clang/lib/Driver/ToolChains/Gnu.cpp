@@ -1974,6 +1974,17 @@ static llvm::StringRef getGCCToolchainDir(const ArgList &Args,
 /// This performs all of the autodetection and sets up the various paths.
 /// Once constructed, a GCCInstallationDetector is essentially immutable.
 ///
+/// The probing below is a directory scan per candidate prefix, repeated by
+/// every driver invocation. Persisting the outcome in an on-disk cache
+/// keyed by mtimes does not actually avoid the expense that motivates it:
+/// validating such a cache still stats each probed directory (on NFS, the
+/// same round trips as the miss path), while a cache trusted without
+/// validation silently pins a stale GCC installation — a correctness trap
+/// for exactly the shared-filesystem builds that want it. Deployments that
+/// need zero probing should configure the answer away instead:
+/// GCC_INSTALL_PREFIX, --gcc-toolchain, or a config file with explicit
+/// --sysroot make this function a handful of string operations.
+///
 /// FIXME: We shouldn't need an explicit TargetTriple parameter here, and
 /// should instead pull the target out of the driver. This is currently
 /// necessary because the driver doesn't store the final version of the target
@@ -22,6 +22,17 @@ namespace format {
 struct FormatToken;
 class AnnotatedLine;
 
+// This is as incremental as formatting can safely get: only lines marked
+// affected here (the edit plus the continuations that depend on it) are
+// re-solved, but the whole file is still lexed and parsed each call because
+// that is what establishes the context a line's annotation depends on —
+// preprocessor state, macro definitions, and bracket/scope nesting from
+// arbitrarily far above. Memoizing TokenAnnotator results across calls keyed
+// on line content has been looked at and doesn't work: identical text
+// annotates differently in different contexts, and annotations point into the
+// current parse's token allocator, so cached entries would dangle. Editor
+// integrations get their latency back by passing tight ranges, which keeps the
+// expensive layout solving proportional to the edit.
 class AffectedRangeManager {
 public:
   AffectedRangeManager(const SourceManager &SourceMgr,
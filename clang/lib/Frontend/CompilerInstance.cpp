@@ -1404,6 +1404,16 @@ static bool compileModuleAndReadASTImpl(CompilerInstance &ImportingInstance,
 /// returning true if the module compiles without errors, using a lock manager
 /// to avoid building the same module in multiple compiler instances.
 ///
+/// Note that the lock exists only on this build path: deployments that
+/// populate the module cache ahead of time can point consumers at the
+/// finished PCMs via -fprebuilt-module-path, which loads them through
+/// ASTReader without ever reaching this function, and can pair that with
+/// -fno-validate-pch (DisableValidationForModuleKind) to skip the
+/// per-input-file signature checks. PCMs are mmapped by MemoryBuffer as it
+/// is, and SourceLocations are rebased with a per-module offset at load
+/// rather than rewritten, so that combination is effectively a read-only,
+/// lock-free, validation-free cache without a separate sealed image format.
+///
 /// Uses a lock file manager and exponential backoff to reduce the chances that
 /// multiple instances will compete to create the same module.  On timeout,
 /// deletes the lock file in order to avoid deadlock from crashing processes or
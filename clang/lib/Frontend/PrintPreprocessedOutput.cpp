@@ -956,6 +956,14 @@ static void DoPrintMacros(Preprocessor &PP, raw_ostream *OS) {
 
 /// DoPrintPreprocessedInput - This implements -E mode.
 ///
+/// Output is produced by lexing every token through the preprocessor. A
+/// splice-from-source fast path for regions "without macros or directives"
+/// keeps getting proposed for distributed-build wrappers and is not sound
+/// on directive-only scanning alone: whether an identifier is a macro use
+/// depends on the macro table accumulated from everything included before
+/// it, so each identifier in the region must be checked against the live
+/// table — which is precisely the cheap bit the Lex loop already does; the
+/// directive scanner can find directives but cannot prove expansion-free.
 void clang::DoPrintPreprocessedInput(Preprocessor &PP, raw_ostream *OS,
                                      const PreprocessorOutputOptions &Opts) {
   // Show macros with no output is handled specially.
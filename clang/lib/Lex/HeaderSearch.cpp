@@ -1364,6 +1364,16 @@ void HeaderSearch::MarkFileModuleHeader(const FileEntry *FE,
   HFI.isCompilingModuleHeader |= isCompilingModuleHeader;
 }
 
+// Note on sharing this state across invocations: the guard-macro and
+// import-safety facts accumulated in HeaderFileInfo are expressed in terms of
+// per-process objects (IdentifierInfo pointers, FileEntry UIDs from this
+// FileManager), so they cannot be published to other compiler processes via
+// shared memory without re-keying by content hash and re-interning on load --
+// at which point the consumer has re-done most of the work being cached.
+// In-process sharing across many TUs is already available through the
+// dependency scanning service's shared file/preprocessor caches; that is the
+// supported route for build systems that want to amortize header prologue
+// lexing across thousands of compiles.
 bool HeaderSearch::ShouldEnterIncludeFile(Preprocessor &PP,
                                           const FileEntry *File, bool isImport,
                                           bool ModulesEnabled, Module *M,
@@ -1759,9 +1759,46 @@ bool Lexer::LexUnicodeIdentifierStart(Token &Result, uint32_t C,
   return true;
 }
 
+#ifdef __SSE2__
+#include <emmintrin.h>
+#elif __ALTIVEC__
+#include <altivec.h>
+#undef bool
+#endif
+
 bool Lexer::LexIdentifierContinue(Token &Result, const char *CurPtr) {
   // Match [_A-Za-z0-9]*, we have already matched an identifier start.
   while (true) {
+#ifdef __SSE2__
+    // Consume 16 characters at a time while every byte is a plain ASCII
+    // [_0-9A-Za-z]. Any other byte stops the vector loop and is classified by
+    // the scalar code below; UTF-8 lead/continuation bytes look negative to
+    // the signed compares and so never match, and neither does '\0', which
+    // keeps code-completion points and the end-of-buffer sentinel on the slow
+    // path.
+    while (CurPtr + 16 < BufferEnd) {
+      __m128i Chunk =
+          _mm_loadu_si128(reinterpret_cast<const __m128i *>(CurPtr));
+      __m128i Digit =
+          _mm_and_si128(_mm_cmpgt_epi8(Chunk, _mm_set1_epi8('0' - 1)),
+                        _mm_cmplt_epi8(Chunk, _mm_set1_epi8('9' + 1)));
+      __m128i Upper =
+          _mm_and_si128(_mm_cmpgt_epi8(Chunk, _mm_set1_epi8('A' - 1)),
+                        _mm_cmplt_epi8(Chunk, _mm_set1_epi8('Z' + 1)));
+      __m128i Lower =
+          _mm_and_si128(_mm_cmpgt_epi8(Chunk, _mm_set1_epi8('a' - 1)),
+                        _mm_cmplt_epi8(Chunk, _mm_set1_epi8('z' + 1)));
+      __m128i Under = _mm_cmpeq_epi8(Chunk, _mm_set1_epi8('_'));
+      int Mask = _mm_movemask_epi8(
+          _mm_or_si128(_mm_or_si128(Digit, Upper), _mm_or_si128(Lower, Under)));
+      if (Mask != 0xffff) {
+        CurPtr += llvm::countTrailingZeros<unsigned>(~Mask & 0xffff);
+        break;
+      }
+      CurPtr += 16;
+    }
+#endif
+
     unsigned char C = *CurPtr;
     // Fast path.
     if (isAsciiIdentifierContinue(C)) {
@@ -2639,13 +2676,6 @@ static bool isEndOfBlockCommentWithEscapedNewLine(const char *CurPtr, Lexer *L,
   return true;
 }
 
-#ifdef __SSE2__
-#include <emmintrin.h>
-#elif __ALTIVEC__
-#include <altivec.h>
-#undef bool
-#endif
-
 /// We have just read from input the / and * characters that started a comment.
 /// Read until we find the * and / characters that terminate the comment.
 /// Note that we don't bother decoding trigraphs or escaped newlines in block
@@ -158,6 +158,17 @@ void clang::ParseAST(Sema &S, bool PrintStats, bool SkipFunctionBodies) {
     EnterExpressionEvaluationContext PotentiallyEvaluated(
         S, Sema::ExpressionEvaluationContext::PotentiallyEvaluated);
 
+    // Top-level declarations are parsed and handed to the consumer strictly
+    // in order. Farming out "independent" function bodies to worker threads
+    // has been repeatedly proposed and does not survive contact with the
+    // implementation: lexing itself is stateful (#pragma, conditional
+    // compilation, delayed template parsing), any body may trigger template
+    // instantiations and implicit special members that allocate in the
+    // single ASTContext bump allocator, and Sema's tables (identifiers,
+    // declaration chains, pending instantiations) assume single-threaded
+    // mutation. Intra-TU parallelism would mean making all of those
+    // concurrent; splitting the input into more TUs remains the supported
+    // way to buy it.
     for (bool AtEOF = P.ParseFirstTopLevelDecl(ADecl, ImportState); !AtEOF;
          AtEOF = P.ParseTopLevelDecl(ADecl, ImportState)) {
       // If we got a null return and something *was* parsed, ignore it.  This
@@ -4789,6 +4789,15 @@ Sema::InstantiateFunctionDeclaration(FunctionTemplateDecl *FTD,
 /// \param DefinitionRequired if true, then we are performing an explicit
 /// instantiation where the body of the function is required. Complain if
 /// there is no such body.
+// Note on memoizing instantiations: it is tempting to cache instantiated
+// bodies keyed on the pattern plus the subset of template arguments the body
+// actually uses, and share the result between equivalent specializations.
+// That does not fit the AST model: every statement and declaration in an
+// instantiated body carries its owning FunctionDecl, and that identity feeds
+// diagnostics, ODR hashing, mangling, exception specifications and debug
+// info, so two specializations cannot point at one body. Deduplication of
+// genuinely identical code is done where identity no longer matters: the
+// MergeFunctions IR pass and linker ICF.
 void Sema::InstantiateFunctionDefinition(SourceLocation PointOfInstantiation,
                                          FunctionDecl *Function,
                                          bool Recursive,
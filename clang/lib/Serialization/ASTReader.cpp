@@ -2095,7 +2095,13 @@ void ASTReader::updateOutOfDateIdentifier(IdentifierInfo &II) {
     PriorGeneration = IdentifierGeneration[&II];
 
   // If there is a global index, look there first to determine which modules
-  // provably do not have any results for this identifier.
+  // provably do not have any results for this identifier. This is the
+  // negative-lookup filter for many-module builds: one lookup in the index
+  // replaces a probe of every loaded module's on-disk hash table, and the
+  // resulting hit set prunes the module visitation below. Per-module bloom
+  // filters would duplicate this less precisely — the index is exact, is
+  // built once per module cache (-fmodules-global-index), and already
+  // amortizes across all identifiers.
   GlobalModuleIndex::HitSet Hits;
   GlobalModuleIndex::HitSet *HitsPtr = nullptr;
   if (!loadGlobalIndex()) {
@@ -2687,8 +2693,15 @@ ASTReader::ReadControlBlock(ModuleFile &F,
         if (ValidateSystemInputs ||
             (HSOpts.ModulesValidateOncePerBuildSession &&
              F.InputFilesValidationTimestamp <= HSOpts.BuildSessionTimestamp &&
-             F.Kind == MK_ImplicitModule))
+             (F.Kind == MK_ImplicitModule || F.Kind == MK_PCH)))
           N = NumInputs;
+        else if (HSOpts.ModulesValidateOncePerBuildSession &&
+                 F.InputFilesValidationTimestamp >
+                     HSOpts.BuildSessionTimestamp &&
+                 F.Kind == MK_PCH)
+          // This PCH's inputs were all validated earlier in this build
+          // session; don't stat them again.
+          N = 0;
 
         for (unsigned I = 0; I < N; ++I) {
           InputFile IF = getInputFile(F, I+1, Complain);
@@ -4478,12 +4491,13 @@ ASTReader::ASTReadResult ASTReader::ReadAST(StringRef FileName,
           .getHeaderSearchOpts()
           .ModulesValidateOncePerBuildSession) {
     // Now we are certain that the module and all modules it depends on are
-    // up to date.  Create or update timestamp files for modules that are
-    // located in the module cache (not for PCH files that could be anywhere
-    // in the filesystem).
+    // up to date.  Create or update timestamp files for modules located in
+    // the module cache and for PCH files. A PCH may live in a directory we
+    // cannot write to; updateModuleTimestamp fails silently in that case and
+    // the PCH's inputs are simply validated on every load, as before.
     for (unsigned I = 0, N = Loaded.size(); I != N; ++I) {
       ImportedModule &M = Loaded[I];
-      if (M.Mod->Kind == MK_ImplicitModule) {
+      if (M.Mod->Kind == MK_ImplicitModule || M.Mod->Kind == MK_PCH) {
         updateModuleTimestamp(*M.Mod);
       }
     }
@@ -174,7 +174,7 @@ ModuleManager::addModule(StringRef FileName, ModuleKind Type,
   NewModule->ImportLoc = ImportLoc;
   NewModule->InputFilesValidationTimestamp = 0;
 
-  if (NewModule->Kind == MK_ImplicitModule) {
+  if (NewModule->Kind == MK_ImplicitModule || NewModule->Kind == MK_PCH) {
     std::string TimestampFilename = NewModule->getTimestampFilename();
     llvm::vfs::Status Status;
     // A cached stat value would be fine as well.
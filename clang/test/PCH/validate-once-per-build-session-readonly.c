@@ -0,0 +1,25 @@
+// Test the fallback when the PCH lives in a directory we cannot write to:
+// no timestamp file can be created, so the PCH's inputs are validated on
+// every use even within one build session.
+
+// UNSUPPORTED: system-windows
+// REQUIRES: non-root-user
+
+// RUN: rm -rf %t && mkdir -p %t/ro
+// RUN: echo 'void meow(void);' > %t/foo.h
+// RUN: %clang_cc1 -emit-pch -o %t/ro/foo.h.pch -fbuild-session-timestamp=1390000000 -fmodules-validate-once-per-build-session -x c-header %t/foo.h
+// RUN: chmod -w %t/ro
+
+// Using the PCH still works, but no timestamp file appears.
+// RUN: %clang_cc1 -include-pch %t/ro/foo.h.pch -fbuild-session-timestamp=1390000000 -fmodules-validate-once-per-build-session -fsyntax-only %s
+// RUN: ls %t/ro | not grep foo.h.pch.timestamp
+
+// Without a timestamp the inputs are validated on every use, so a modified
+// header is rejected even within the same session.
+// RUN: echo 'void meow2(void);' >> %t/foo.h
+// RUN: not %clang_cc1 -include-pch %t/ro/foo.h.pch -fbuild-session-timestamp=1390000000 -fmodules-validate-once-per-build-session -fsyntax-only %s
+
+// Let lit clean up the output directory.
+// RUN: chmod u+w %t/ro
+
+void test(void) { meow(); }
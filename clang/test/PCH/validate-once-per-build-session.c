@@ -0,0 +1,26 @@
+// Test that -fmodules-validate-once-per-build-session covers PCH files: the
+// first use in a build session validates the PCH's inputs and leaves a
+// timestamp file next to the PCH, and later uses in the same session skip
+// input validation entirely.
+
+// RUN: rm -rf %t && mkdir -p %t
+// RUN: echo 'void meow(void);' > %t/foo.h
+// RUN: %clang_cc1 -emit-pch -o %t/foo.h.pch -fbuild-session-timestamp=1390000000 -fmodules-validate-once-per-build-session -x c-header %t/foo.h
+
+// The first use in the session validates the inputs and creates the
+// timestamp file.
+// RUN: %clang_cc1 -include-pch %t/foo.h.pch -fbuild-session-timestamp=1390000000 -fmodules-validate-once-per-build-session -fsyntax-only %s
+// RUN: ls %t | grep foo.h.pch.timestamp
+
+// Change the header. Later uses in the same session skip input validation,
+// so the stale PCH is still accepted.
+// RUN: echo 'void meow2(void);' >> %t/foo.h
+// RUN: %clang_cc1 -include-pch %t/foo.h.pch -fbuild-session-timestamp=1390000000 -fmodules-validate-once-per-build-session -fsyntax-only %s
+
+// Without once-per-session validation the modified header is rejected.
+// RUN: not %clang_cc1 -include-pch %t/foo.h.pch -fsyntax-only %s
+
+// A later build session (01 January 2100) revalidates and also rejects it.
+// RUN: not %clang_cc1 -include-pch %t/foo.h.pch -fbuild-session-timestamp=4102441200 -fmodules-validate-once-per-build-session -fsyntax-only %s
+
+void test(void) { meow(); }
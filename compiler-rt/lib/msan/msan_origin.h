@@ -50,6 +50,13 @@ namespace __msan {
 //
 // The "zzz" bits of chained origin id are used to store the length (or depth)
 // of the origin chain.
+//
+// Chain links have to be recorded eagerly, at the time of the store: the
+// (stack_id, prev_id) pair captures provenance that no longer exists once the
+// overwritten shadow is gone, so there is nothing a report-time pass could
+// reconstruct lazily. The depot already deduplicates identical links, and
+// growth is bounded by the chain depth limit (kMaxDepth, origin_history_size)
+// and the per-stack fan-out cap (origin_history_per_stack_limit).
 
 class Origin {
  public:
@@ -564,6 +564,14 @@ static int writeProfileWithFileObject(const char *Filename, FILE *File) {
   return rc;
 }
 
+/* Continuous mode is the supported form of asynchronous counter flushing:
+ * counters live in a MAP_SHARED mapping of the profile file (in place on
+ * Darwin, via runtime counter relocation on ELF and COFF), so the OS writes
+ * dirty pages back on its own schedule and nothing is lost if the process is
+ * killed. A runtime-owned snapshot thread on top of this would have to be
+ * async-signal- and fork-safe on every platform the runtime builds for;
+ * services that want periodic snapshots should instead call
+ * __llvm_profile_write_file() from a thread they own. */
 static void initializeProfileForContinuousMode(void) {
   if (!__llvm_profile_is_continuous_mode_enabled())
     return;
@@ -134,6 +134,15 @@ static ValueProfNode *allocateOneNode(void) {
   return Node;
 }
 
+/* Note this path takes no locks: the per-site list is bounded by
+ * VPMaxNumValsPerSite, lookup walks it unsynchronized, count bumps are
+ * plain racy adds (lossy by design), and insertion links nodes with a
+ * single bool-cmpxchg. What multi-threaded services observe on hot call
+ * sites is cache-line contention on the shared node counters, which a
+ * fixed reservoir array per site would exhibit identically — the cure
+ * for that is per-thread counter shadowing with merge-on-flush, a
+ * different runtime mode (see the continuous/merge machinery), not a
+ * different per-site data structure. */
 static COMPILER_RT_ALWAYS_INLINE void
 instrumentTargetValueImpl(uint64_t TargetValue, void *Data,
                           uint32_t CounterIndex, uint64_t CountValue) {
@@ -17,6 +17,11 @@
 namespace __tsan {
 
 // Fixed-size vector clock, used both for threads and sync objects.
+// The fixed 256-slot layout (kThreadSlotCount) replaced the old runtime's
+// growable SyncClock: threads multiplex onto reusable slots, so a sync
+// object costs at most one 512-byte clock regardless of how many threads
+// the process creates, and clocks are only allocated for sync objects
+// that actually see a release operation.
 class VectorClock {
  public:
   VectorClock();
@@ -14,6 +14,13 @@ static void message(const char *msg) {
 }
 #endif
 
+// Deduplication: each recovered check site (identified by caller PC) is
+// reported once; after kMaxCallerPcs distinct sites the runtime prints
+// "too many errors" once and goes silent. A repeated violation therefore
+// costs one handler call plus a short relaxed-atomic scan, with no log I/O.
+// Anything richer (per-site counters, sampling schedules, export through
+// the profile runtime) belongs in the full UBSan runtime; this one stays
+// dependency-free and fixed-footprint so it can ship in production builds.
 static const int kMaxCallerPcs = 20;
 static __sanitizer::atomic_uintptr_t caller_pcs[kMaxCallerPcs];
 // Number of elements in caller_pcs. A special value of kMaxCallerPcs + 1 means
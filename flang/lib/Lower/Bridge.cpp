@@ -184,6 +184,19 @@ public:
   virtual ~FirConverter() = default;
 
   /// Convert the PFT to FIR.
+  ///
+  /// The primary translation pass visits program units in order even though
+  /// they are semantically independent. Lowering them on worker threads has
+  /// been considered and isn't sound with the current structure: all units
+  /// funnel through this one converter — a single FIROpBuilder, symbol map,
+  /// and the lazily created globals (common blocks, module variables,
+  /// runtime type info) that later units look up after earlier units create
+  /// them — and all ops are built into one ModuleOp in one MLIRContext.
+  /// MLIR's multithreading support covers running passes over already-built,
+  /// isolated operations, not concurrent IR construction into a shared
+  /// module; until lowering emits into per-unit modules with a merge step
+  /// (a restructuring of this class, not a loop change), the parallelism
+  /// for large files comes from the pass pipeline downstream.
   void run(Fortran::lower::pft::Program &pft) {
     // Preliminary translation pass.
 
@@ -34,6 +34,18 @@
 //   implementation parameters.
 // - As compilers and processors get better, the generated code is improved
 //   with little change on the code side.
+//
+// Runtime (ifunc-style) dispatch over per-microarchitecture variants is a
+// deliberate non-goal here. The function must stay inlinable — that is where
+// most of its speedup comes from at the small sizes that dominate real
+// workloads — and an indirect call through a resolver defeats both inlining
+// and the PGO branch layout described above, costing more at those sizes
+// than a tuned large-copy loop wins back. It also ties the library to the
+// dynamic loader's IRELATIVE support, which freestanding and static-PIE
+// users of this code don't have. Fleets that straddle microarchitectures get
+// per-SKU tuning by building with the LLVM_LIBC_MEMCPY_* knobs above (the
+// thresholds automemcpy in libc/benchmarks measures) and selecting the
+// binary at deploy time.
 
 namespace __llvm_libc {
 
@@ -11,6 +11,7 @@
 #define _LIBCPP___ALGORITHM_FIND_H
 
 #include <__config>
+#include <__string/char_traits.h>
 
 #if !defined(_LIBCPP_HAS_NO_PRAGMA_SYSTEM_HEADER)
 #  pragma GCC system_header
@@ -27,6 +28,24 @@ find(_InputIterator __first, _InputIterator __last, const _Tp& __value) {
   return __first;
 }
 
+// Overloads for searching a char range for a char: char_traits<char>::find
+// lowers to memchr (and stays usable in constant evaluation through the
+// constexpr string builtins). The value parameter is a char reference, so
+// searches for a non-char value still take the generic overload and keep
+// their promotion-based comparison semantics.
+_LIBCPP_NODISCARD_EXT inline _LIBCPP_INLINE_VISIBILITY _LIBCPP_CONSTEXPR_AFTER_CXX17 const char*
+find(const char* __first, const char* __last, const char& __value) {
+  const char* __r =
+      char_traits<char>::find(__first, static_cast<size_t>(__last - __first), __value);
+  return __r == nullptr ? __last : __r;
+}
+
+_LIBCPP_NODISCARD_EXT inline _LIBCPP_INLINE_VISIBILITY _LIBCPP_CONSTEXPR_AFTER_CXX17 char*
+find(char* __first, char* __last, const char& __value) {
+  return const_cast<char*>(
+      std::find(static_cast<const char*>(__first), static_cast<const char*>(__last), __value));
+}
+
 _LIBCPP_END_NAMESPACE_STD
 
 #endif // _LIBCPP___ALGORITHM_FIND_H
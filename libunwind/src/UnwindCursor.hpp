@@ -91,6 +91,15 @@ namespace libunwind {
 
 #if defined(_LIBUNWIND_SUPPORT_DWARF_UNWIND)
 /// Cache of recently found FDEs.
+///
+/// Deliberately one process-wide table behind a reader/writer lock rather
+/// than per-thread storage: this code must keep working in signal handlers,
+/// during early startup, and on threads being torn down, none of which can
+/// rely on TLS, and image-unload flushing (removeAllIn) has to reach every
+/// cached entry from one place. Readers share the lock and the buffer grows
+/// 4x when full, so the lock only becomes writer-contended while the cache
+/// is still warming. Note that on targets with .eh_frame_hdr the binary
+/// search there is the primary lookup path and this cache is secondary.
 template <typename A>
 class _LIBUNWIND_HIDDEN DwarfFDECache {
   typedef typename A::pint_t pint_t;
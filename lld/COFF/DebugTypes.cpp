@@ -1021,6 +1021,15 @@ TypeMerger::TypeMerger(COFFLinkerContext &c, llvm::BumpPtrAllocator &alloc)
 
 TypeMerger::~TypeMerger() = default;
 
+// The merge is sharded end to end: ghash computation, the deduplicating
+// insertion below (a fixed-size concurrent table), the sort that assigns
+// final PDB type indices, and the per-source record merge into per-source
+// buffers all run on the parallel executor; only the final concatenation
+// into the TPI/IPI streams is sequential, and that is bounded by output
+// size. Persisting the merged table across links would not compose with
+// this scheme: destination type indices are a function of the entire input
+// set, so any input change renumbers every record after the first
+// difference.
 void TypeMerger::mergeTypesWithGHash() {
   // Load ghashes. Do type servers and PCH objects first.
   {
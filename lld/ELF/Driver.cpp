@@ -2424,6 +2424,15 @@ static void postParseObjectFile(ELFFileBase *file) {
 
 // Do actual linking. Note that when this function is called,
 // all linker scripts have already been parsed.
+// Incremental relinking (persisting the previous link's layout and patching
+// only sections from changed inputs) has been evaluated and deliberately not
+// implemented: nearly every post-scan decision -- symbol resolution, GOT/PLT
+// assignment, relaxation, string merging, address assignment -- depends on
+// global state, so a correct implementation needs a full dependency-tracking
+// layer plus a verifier that falls back to a full link whenever a constraint
+// (section size change, new undefined symbol, layout-affecting flag) breaks.
+// Until such a layer exists, keep the driver a pure function of its inputs;
+// re-run from scratch on every invocation.
 void LinkerDriver::link(opt::InputArgList &args) {
   llvm::TimeTraceScope timeScope("Link", StringRef("LinkerDriver::Link"));
   // If a --hash-style option was not given, set to a default value,
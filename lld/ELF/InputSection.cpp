@@ -1355,7 +1355,11 @@ void MergeInputSection::splitStrings(StringRef s, size_t entSize) {
   if (!std::all_of(end - entSize, end, [](char c) { return c == 0; }))
     fatal(toString(this) + ": string is not null terminated");
   if (entSize == 1) {
-    // Optimize the common case.
+    // Optimize the common case. Every string consumes exactly one NUL, so
+    // counting NULs up front (vectorized by the standard library) sizes
+    // pieces exactly and avoids reallocation; .debug_str sections can hold
+    // millions of strings.
+    pieces.reserve(std::count(p, end, '\0'));
     do {
       size_t size = strlen(p);
       pieces.emplace_back(p - s.begin(), xxHash64(StringRef(p, size)), live);
@@ -319,6 +319,15 @@ static SmallVector<uint8_t, 0> deflateShard(ArrayRef<uint8_t> in, int level,
 #endif
 
 // Compress section contents if this section contains debug info.
+//
+// This cannot start before address assignment finishes: writeTo applies
+// relocations, and debug sections embed the final addresses of allocatable
+// sections, so the bytes being compressed only exist once layout is done.
+// Within that window the shards below already use every thread. Reusing
+// compressed chunks from a previous link of the same inputs would need a
+// persistent cache directory, which lld deliberately does not have — each
+// link is a stateless process, and incremental-relink caching lives in the
+// build system or in tools like distributed ThinLTO caches, not here.
 template <class ELFT> void OutputSection::maybeCompress() {
 #if LLVM_ENABLE_ZLIB
   using Elf_Chdr = typename ELFT::Chdr;
@@ -1510,8 +1510,12 @@ void RelocationScanner::scan(ArrayRef<RelTy> rels) {
 }
 
 template <class ELFT> void elf::scanRelocations(InputSectionBase &s) {
-  RelocationScanner scanner(s);
   const RelsOrRelas<ELFT> rels = s.template relsOrRelas<ELFT>();
+  // Many alloc sections carry no relocations at all; skip constructing the
+  // scanner (whose OffsetGetter walks .eh_frame pieces) for those.
+  if (rels.areRelocsRel() ? rels.rels.empty() : rels.relas.empty())
+    return;
+  RelocationScanner scanner(s);
   if (rels.areRelocsRel())
     scanner.template scan<ELFT>(rels.rels);
   else
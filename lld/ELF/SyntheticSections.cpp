@@ -1704,8 +1704,8 @@ void RelocationBaseSection::computeRels() {
   // is to make results easier to read.
   if (combreloc) {
     auto nonRelative = relocs.begin() + numRelativeRelocs;
-    parallelSort(relocs.begin(), nonRelative,
-                 [&](auto &a, auto &b) { return a.r_offset < b.r_offset; });
+    parallelSortByKey(relocs.begin(), nonRelative,
+                      [](const DynamicReloc &r) { return r.r_offset; });
     // Non-relative relocations are few, so don't bother with parallelSort.
     llvm::sort(nonRelative, relocs.end(), [&](auto &a, auto &b) {
       return std::tie(a.r_sym, a.r_offset) < std::tie(b.r_sym, b.r_offset);
@@ -1936,6 +1936,13 @@ template <class ELFT> void Writer<ELFT>::finalizeSections() {
       // determine if it needs special treatment, such as creating GOT, PLT,
       // copy relocations, etc. Note that relocations for non-alloc sections are
       // directly processed by InputSection::relocateNonAlloc.
+      //
+      // Scanning writes sec->relocations (per-section, safe to parallelize)
+      // but also sets Symbol bit-flags (needsGot etc.), appends to the
+      // synthetic dynamic relocation sections, and allocates symbol aux
+      // entries. Until those updates are made atomic and the dynamic
+      // relocation order is made independent of scan order, this loop must
+      // stay serial to keep output deterministic.
       for (InputSectionBase *sec : inputSections)
         if (sec->isLive() && isa<InputSection>(sec) && (sec->flags & SHF_ALLOC))
           scanRelocations<ELFT>(*sec);
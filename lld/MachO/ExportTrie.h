@@ -22,7 +22,6 @@ class Symbol;
 
 class TrieBuilder {
 public:
-  ~TrieBuilder();
   void setImageBase(uint64_t addr) { imageBase = addr; }
   void addSymbol(const Symbol &sym) { exported.push_back(&sym); }
   // Returns the size in bytes of the serialized trie.
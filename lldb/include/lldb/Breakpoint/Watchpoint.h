@@ -10,6 +10,7 @@
 #define LLDB_BREAKPOINT_WATCHPOINT_H
 
 #include <memory>
+#include <mutex>
 #include <string>
 
 #include "lldb/Breakpoint/StoppointSite.h"
@@ -146,6 +147,18 @@ public:
   //     condition has been set.
   const char *GetConditionText() const;
 
+  /// Evaluate the watchpoint's condition in the given execution context.
+  ///
+  /// The compiled condition is cached and reused across hits; it is only
+  /// reparsed when the condition text changes or the cached expression no
+  /// longer matches the context it was compiled for.
+  ///
+  /// \return
+  ///     \b true if the target should stop at this watchpoint and \b false
+  ///     not. On a parse error \p error is set and \b true is returned so
+  ///     the user gets to see the error.
+  bool ConditionSaysStop(ExecutionContext &exe_ctx, Status &error);
+
   void TurnOnEphemeralMode();
 
   void TurnOffEphemeralMode();
@@ -195,7 +208,17 @@ private:
                  // the callback machinery.
   bool m_being_created;
 
-  std::unique_ptr<UserExpression> m_condition_up; // The condition to test.
+  std::string m_condition_text;     // The condition to test.
+  size_t m_condition_text_hash = 0; // Its hash, so that locals can know if it
+                                    // was last evaluated in the same condition
+                                    // state.
+  std::mutex m_condition_mutex; // Guards parsing and evaluation of the
+                                // condition, which could be evaluated by
+                                // multiple processes.
+  size_t m_condition_hash = 0;  // Hash of the text the compiled condition
+                                // below was built from.
+  lldb::UserExpressionSP m_user_expression_sp; // The compiled condition,
+                                               // reused across hits.
 
   void SetID(lldb::watch_id_t id) { m_id = id; }
 
@@ -12,9 +12,13 @@
 #include "lldb/Core/Value.h"
 #include "lldb/Core/ValueObject.h"
 #include "lldb/Core/ValueObjectMemory.h"
+#include "lldb/Expression/DiagnosticManager.h"
+#include "lldb/Expression/ExpressionVariable.h"
 #include "lldb/Expression/UserExpression.h"
+#include "lldb/Symbol/CompileUnit.h"
 #include "lldb/Symbol/TypeSystem.h"
 #include "lldb/Target/Process.h"
+#include "lldb/Target/StackFrame.h"
 #include "lldb/Target/Target.h"
 #include "lldb/Target/ThreadSpec.h"
 #include "lldb/Utility/LLDBLog.h"
@@ -280,31 +284,131 @@ bool Watchpoint::InvokeCallback(StoppointCallbackContext *context) {
 }
 
 void Watchpoint::SetCondition(const char *condition) {
-  if (condition == nullptr || condition[0] == '\0') {
-    if (m_condition_up)
-      m_condition_up.reset();
-  } else {
-    // Pass nullptr for expr_prefix (no translation-unit level definitions).
-    Status error;
-    m_condition_up.reset(m_target.GetUserExpressionForLanguage(
-        condition, llvm::StringRef(), lldb::eLanguageTypeUnknown,
-        UserExpression::eResultTypeAny, EvaluateExpressionOptions(), nullptr,
-        error));
-    if (error.Fail()) {
-      // FIXME: Log something...
-      m_condition_up.reset();
+  {
+    std::lock_guard<std::mutex> guard(m_condition_mutex);
+    if (condition == nullptr || condition[0] == '\0') {
+      m_condition_text.clear();
+      m_condition_text_hash = 0;
+    } else {
+      m_condition_text.assign(condition);
+      std::hash<std::string> hasher;
+      m_condition_text_hash = hasher(m_condition_text);
     }
+    // Drop any compiled expression; ConditionSaysStop() will rebuild it the
+    // next time the watchpoint is hit.
+    m_user_expression_sp.reset();
   }
   SendWatchpointChangedEvent(eWatchpointEventTypeConditionChanged);
 }
 
 const char *Watchpoint::GetConditionText() const {
-  if (m_condition_up)
-    return m_condition_up->GetUserText();
+  if (!m_condition_text.empty())
+    return m_condition_text.c_str();
   else
     return nullptr;
 }
 
+bool Watchpoint::ConditionSaysStop(ExecutionContext &exe_ctx, Status &error) {
+  Log *log = GetLog(LLDBLog::Watchpoints);
+
+  std::lock_guard<std::mutex> guard(m_condition_mutex);
+
+  if (m_condition_text.empty()) {
+    m_user_expression_sp.reset();
+    return false;
+  }
+
+  error.Clear();
+
+  DiagnosticManager diagnostics;
+
+  if (m_condition_text_hash != m_condition_hash || !m_user_expression_sp ||
+      !m_user_expression_sp->MatchesContext(exe_ctx)) {
+    LanguageType language = eLanguageTypeUnknown;
+    // See if we can figure out the language from the frame, otherwise use the
+    // default language:
+    if (StackFrame *frame = exe_ctx.GetFramePtr()) {
+      SymbolContext sc = frame->GetSymbolContext(eSymbolContextCompUnit);
+      if (sc.comp_unit)
+        language = sc.comp_unit->GetLanguage();
+    }
+
+    m_user_expression_sp.reset(m_target.GetUserExpressionForLanguage(
+        m_condition_text, llvm::StringRef(), language,
+        Expression::eResultTypeAny, EvaluateExpressionOptions(), nullptr,
+        error));
+    if (error.Fail()) {
+      LLDB_LOGF(log, "Error getting condition expression: %s.",
+                error.AsCString());
+      m_user_expression_sp.reset();
+      return true;
+    }
+
+    if (!m_user_expression_sp->Parse(diagnostics, exe_ctx,
+                                     eExecutionPolicyOnlyWhenNeeded, true,
+                                     false)) {
+      error.SetErrorStringWithFormat(
+          "Couldn't parse conditional expression:\n%s",
+          diagnostics.GetString().c_str());
+      m_user_expression_sp.reset();
+      return true;
+    }
+
+    m_condition_hash = m_condition_text_hash;
+  }
+
+  // We need to make sure the user sees any parse errors in their condition,
+  // so we'll hook the constructor errors up to the debugger's Async I/O.
+
+  ValueObjectSP result_value_sp;
+
+  EvaluateExpressionOptions options;
+  options.SetUnwindOnError(true);
+  options.SetIgnoreBreakpoints(true);
+  options.SetTryAllThreads(true);
+  options.SetResultIsInternal(
+      true); // Don't generate a user variable for condition expressions.
+
+  diagnostics.Clear();
+
+  ExpressionVariableSP result_variable_sp;
+
+  ExpressionResults result_code = m_user_expression_sp->Execute(
+      diagnostics, exe_ctx, options, m_user_expression_sp, result_variable_sp);
+
+  bool ret;
+
+  if (result_code == eExpressionCompleted) {
+    if (!result_variable_sp) {
+      error.SetErrorString("Expression did not return a result");
+      return false;
+    }
+
+    result_value_sp = result_variable_sp->GetValueObject();
+
+    if (result_value_sp) {
+      ret = result_value_sp->IsLogicalTrue(error);
+      if (error.Success()) {
+        LLDB_LOGF(log, "Condition successfully evaluated, result is %s.\n",
+                  ret ? "true" : "false");
+      } else {
+        error.SetErrorString(
+            "Failed to get an integer result from the expression");
+        ret = false;
+      }
+    } else {
+      ret = false;
+      error.SetErrorString("Failed to get any result from the expression");
+    }
+  } else {
+    ret = false;
+    error.SetErrorStringWithFormat("Couldn't execute expression:\n%s",
+                                   diagnostics.GetString().c_str());
+  }
+
+  return ret;
+}
+
 void Watchpoint::SendWatchpointChangedEvent(
     lldb::WatchpointEventType eventKind) {
   if (!m_being_created &&
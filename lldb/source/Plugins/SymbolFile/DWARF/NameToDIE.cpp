@@ -85,6 +85,7 @@ void NameToDIE::ForEach(
 
 void NameToDIE::Append(const NameToDIE &other) {
   const uint32_t size = other.m_map.GetSize();
+  m_map.Reserve(m_map.GetSize() + size);
   for (uint32_t i = 0; i < size; ++i) {
     m_map.Append(other.m_map.GetCStringAtIndexUnchecked(i),
                  other.m_map.GetValueAtIndexUnchecked(i));
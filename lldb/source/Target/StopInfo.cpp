@@ -841,43 +841,18 @@ protected:
         Debugger &debugger = exe_ctx.GetTargetRef().GetDebugger();
 
         if (m_should_stop && wp_sp->GetConditionText() != nullptr) {
-          // We need to make sure the user sees any parse errors in their
+          // The watchpoint keeps the compiled condition around, so after the
+          // first hit this only re-runs the already JITed expression.  We
+          // need to make sure the user sees any parse errors in their
           // condition, so we'll hook the constructor errors up to the
           // debugger's Async I/O.
-          ExpressionResults result_code;
-          EvaluateExpressionOptions expr_options;
-          expr_options.SetUnwindOnError(true);
-          expr_options.SetIgnoreBreakpoints(true);
-          ValueObjectSP result_value_sp;
-          Status error;
-          result_code = UserExpression::Evaluate(
-              exe_ctx, expr_options, wp_sp->GetConditionText(),
-              llvm::StringRef(), result_value_sp, error);
-
-          if (result_code == eExpressionCompleted) {
-            if (result_value_sp) {
-              Scalar scalar_value;
-              if (result_value_sp->ResolveValue(scalar_value)) {
-                if (scalar_value.ULongLong(1) == 0) {
-                  // We have been vetoed.  This takes precedence over querying
-                  // the watchpoint whether it should stop (aka ignore count
-                  // and friends).  See also StopInfoWatchpoint::ShouldStop()
-                  // as well as Process::ProcessEventData::DoOnRemoval().
-                  m_should_stop = false;
-                } else
-                  m_should_stop = true;
-                LLDB_LOGF(log,
-                          "Condition successfully evaluated, result is %s.\n",
-                          m_should_stop ? "true" : "false");
-              } else {
-                m_should_stop = true;
-                LLDB_LOGF(
-                    log,
-                    "Failed to get an integer result from the expression.");
-              }
-            }
-          } else {
-            const char *err_str = error.AsCString("<unknown error>");
+          Status condition_error;
+          bool condition_says_stop =
+              wp_sp->ConditionSaysStop(exe_ctx, condition_error);
+
+          if (!condition_error.Success()) {
+            const char *err_str =
+                condition_error.AsCString("<unknown error>");
             LLDB_LOGF(log, "Error evaluating condition: \"%s\"\n", err_str);
 
             StreamString strm;
@@ -889,6 +864,12 @@ protected:
 
             Debugger::ReportError(strm.GetString().str(),
                                   exe_ctx.GetTargetRef().GetDebugger().GetID());
+          } else if (!condition_says_stop) {
+            // We have been vetoed.  This takes precedence over querying
+            // the watchpoint whether it should stop (aka ignore count
+            // and friends).  See also StopInfoWatchpoint::ShouldStop()
+            // as well as Process::ProcessEventData::DoOnRemoval().
+            m_should_stop = false;
           }
         }
 
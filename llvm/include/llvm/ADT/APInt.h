@@ -1819,6 +1819,15 @@ public:
 private:
   /// This union is used to store the integer value. When the
   /// integer bit-width <= 64, it uses VAL, otherwise it uses pVal.
+  ///
+  /// Widening the inline storage to two words (so 128-bit values avoid the
+  /// heap) has been considered and rejected: it grows sizeof(APInt) from 16
+  /// to 24 bytes for every APInt everywhere -- ConstantInt, KnownBits,
+  /// ConstantRange, DenseMap keys -- while the overwhelming majority of
+  /// APInts fit in one word and would carry the extra word as padding.
+  /// Multi-word temporaries are better avoided at the call sites: the
+  /// by-value operator overloads below let chained arithmetic reuse an
+  /// rvalue operand's allocation instead of mallocing per step.
   union {
     uint64_t VAL;   ///< Used to store the <= 64 bits integer value.
     uint64_t *pVal; ///< Used to store the >64 bits integer value.
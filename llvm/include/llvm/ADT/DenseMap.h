@@ -403,11 +403,22 @@ protected:
     for (BucketT *B = OldBucketsBegin, *E = OldBucketsEnd; B != E; ++B) {
       if (!KeyInfoT::isEqual(B->getFirst(), EmptyKey) &&
           !KeyInfoT::isEqual(B->getFirst(), TombstoneKey)) {
-        // Insert the key/value into the new table.
+        // Insert the key/value into the new table. The new table has no
+        // tombstones and cannot already contain the key, so instead of going
+        // through the generic LookupBucketFor (which compares the key against
+        // every probed bucket), just probe for the first empty bucket.
+        const unsigned NumBuckets = getNumBuckets();
+        BucketT *BucketsBegin = getBuckets();
+        unsigned BucketNo = getHashValue(B->getFirst()) & (NumBuckets - 1);
+        unsigned ProbeAmt = 1;
         BucketT *DestBucket;
-        bool FoundVal = LookupBucketFor(B->getFirst(), DestBucket);
-        (void)FoundVal; // silence warning.
-        assert(!FoundVal && "Key already in new map?");
+        while (true) {
+          DestBucket = BucketsBegin + BucketNo;
+          if (KeyInfoT::isEqual(DestBucket->getFirst(), EmptyKey))
+            break;
+          BucketNo += ProbeAmt++;
+          BucketNo &= (NumBuckets - 1);
+        }
         DestBucket->getFirst() = std::move(B->getFirst());
         ::new (&DestBucket->getSecond()) ValueT(std::move(B->getSecond()));
         incrementNumEntries();
@@ -39,6 +39,15 @@
 // benchmarked at over 6.5 GiB/s for large keys, and <20 cycles/hash for keys
 // under 32-bytes.
 //
+// On replacing the mix function: most keys hashed through this header are a
+// handful of words, where the fixed-size paths below are already a few
+// multiplies — bulk-throughput hashes only pull ahead on long buffers, and
+// callers hashing those (Support/xxhash.h) can use xxHash64 directly.
+// Per-process seeding is likewise a design point, not an oversight: it keeps
+// hash_codes from being persisted and then silently invalidated by an
+// algorithm change. On-disk formats must use a hash they pin themselves
+// (xxHash64, MD5, DJB), as lld and DWARF emission do today.
+//
 //===----------------------------------------------------------------------===//
 
 #ifndef LLVM_ADT_HASHING_H
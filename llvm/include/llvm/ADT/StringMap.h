@@ -106,6 +106,16 @@ public:
 /// keys that are "strings", which are basically ranges of bytes. This does some
 /// funky memory allocation and hashing things to make it extremely efficient,
 /// storing the string data *after* the value in the map.
+///
+/// Each entry is a single allocation from AllocatorTy holding the value
+/// followed by the key bytes, so with a BumpPtrAllocator (as used by clang's
+/// IdentifierTable and MCContext's symbol tables) keys of any length live
+/// inline in the allocator's slabs, and the bucket array caches each entry's
+/// full hash. There is deliberately no concurrent or sharded flavor of this
+/// container: every current heavy user confines its map to one thread or
+/// context, and the entry allocator would serialize concurrent inserters
+/// anyway. Callers wanting parallelism should shard at a higher level, with
+/// one map (and one allocator) per worker.
 template <typename ValueTy, typename AllocatorTy = MallocAllocator>
 class StringMap : public StringMapImpl,
                   private detail::AllocatorHolder<AllocatorTy> {
@@ -948,6 +948,15 @@ private:
 /// esentially making AA work in "batch mode". The internal state cannot be
 /// cleared, so to go "out-of-batch-mode", the user must either use AAResults,
 /// or create a new BatchAAResults.
+///
+/// This is deliberately the coarsest caching granularity offered. A cache
+/// that survives IR mutation would need more than per-value invalidation:
+/// BasicAA's answers derive from whole chains of GEPs, selects and phis, so
+/// rewriting any link invalidates conclusions cached against the endpoints,
+/// which ValueHandles on the queried pointers cannot see. Passes that
+/// interleave queries with transformation (LICM, DSE, MemCpyOpt) therefore
+/// scope one of these objects to each span of read-only queries and drop it
+/// at the first write, which keeps the cache trivially sound.
 class BatchAAResults {
   AAResults &AA;
   AAQueryInfo AAQI;
@@ -80,6 +80,18 @@ public:
   bool isIrrLoopHeader(const BasicBlock *BB);
 
   // Set the frequency of the given basic block.
+  //
+  // This and setBlockFreqAndScale below are the supported local-update
+  // surface for CFG-mutating passes that want to keep a BFI alive instead of
+  // recomputing it (JumpThreading patches threaded blocks this way, and
+  // extraction/peeling-style transforms use the scaling form for cloned
+  // regions). They deliberately stop at patching block values: frequencies
+  // are the solution of a whole-function flow problem, so a structural edit
+  // that changes loop scales or redirects probability mass has effects that
+  // are not confined to any local region, and a general "fix up this edge"
+  // entry point would either recompute globally anyway or silently leave the
+  // rest of the function inconsistent. Passes should patch what they can
+  // bound (as the callers above do) and invalidate otherwise.
   void setBlockFreq(const BasicBlock *BB, uint64_t Freq);
 
   /// Set the frequency of \p ReferenceBB to \p Freq and scale the frequencies
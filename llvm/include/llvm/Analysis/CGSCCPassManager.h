@@ -525,6 +525,15 @@ createCGSCCToFunctionPassAdaptor(FunctionPassT &&Pass,
 // function pass (manager) on a function multiple times if SCC mutations cause a
 // function to be visited multiple times and the function is not modified by
 // other SCC passes.
+//
+// This is the dirty-bit-at-function-granularity mechanism: the adaptor caches
+// this marker after a clean run (when NoRerun is set, as it is for the
+// simplification pipeline under -enable-no-rerun-simplification-pipeline, on
+// by default), and anything that mutates the function clears it through the
+// ordinary analysis invalidation path — no separate instrumentation hook is
+// needed, since a pass that changes IR must already invalidate cached
+// analyses, and one that preserves all analyses by definition left the
+// function alone.
 class ShouldNotRunFunctionPassesAnalysis
     : public AnalysisInfoMixin<ShouldNotRunFunctionPassesAnalysis> {
 public:
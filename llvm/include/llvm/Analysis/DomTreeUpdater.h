@@ -25,6 +25,17 @@
 namespace llvm {
 class PostDominatorTree;
 
+/// Batches updates to a (post)dominator tree. With the Lazy strategy updates
+/// are queued and only materialized when a tree is queried through this
+/// class, so a pass pays for at most one incremental update per batch rather
+/// than one per CFG change.
+///
+/// A DomTreeUpdater is intentionally scoped to a single pass. Extending one
+/// batch across several passes (so a pipeline flushes once per function)
+/// does not work with the pass managers: a pass that reports
+/// DominatorTreeAnalysis as preserved must leave the cached tree correct at
+/// pass exit, because any later pass, analysis, or the verifier may read it
+/// directly from the analysis manager without going through this class.
 class DomTreeUpdater {
 public:
   enum class UpdateStrategy : unsigned char { Eager = 0, Lazy = 1 };
@@ -1946,6 +1946,18 @@ private:
   /// Helper for forgetMemoizedResults.
   void forgetMemoizedResultsImpl(const SCEV *S);
 
+  /// Helper for forgetLoop and forgetValue. Erase the cached SCEVs for the
+  /// instructions on \p Worklist and, transitively, their users. Users must
+  /// be visited even when the instruction at hand has no cached SCEV: a user
+  /// may be cached as an opaque SCEVUnknown whose range was derived from the
+  /// instruction's bits, and with.overflow intrinsics are modeled through
+  /// their scalar operands although the struct-typed call itself is never in
+  /// the map. Only instructions that are neither SCEVable nor with.overflow
+  /// calls are skipped.
+  void visitAndClearUsers(SmallVectorImpl<Instruction *> &Worklist,
+                          SmallPtrSetImpl<Instruction *> &Visited,
+                          SmallVectorImpl<const SCEV *> &ToForget);
+
   /// Return an existing SCEV for V if there is one, otherwise return nullptr.
   const SCEV *getExistingSCEV(Value *V);
 
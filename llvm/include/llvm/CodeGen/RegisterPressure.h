@@ -354,6 +354,13 @@ public:
 /// explicitly called. Similarly, P.TopIdx is invalid during upward
 /// tracking. Changing direction has the side effect of closing region, and
 /// traversing past TopIdx or BottomIdx reopens it.
+///
+/// Pressure is tracked per traversal rather than persisted per slot on the
+/// block because the quantity is order-dependent: the scheduler exists to
+/// reorder instructions, and every candidate move changes the pressure at
+/// every slot it crosses. Precomputed per-slot annotations would be
+/// invalidated by the very transformation querying them, and machine IR
+/// offers no mutation listener to keep them honest.
 class RegPressureTracker {
   const MachineFunction *MF = nullptr;
   const TargetRegisterInfo *TRI = nullptr;
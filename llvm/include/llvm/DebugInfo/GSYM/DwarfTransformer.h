@@ -12,6 +12,7 @@
 #include "llvm/ADT/StringRef.h"
 #include "llvm/DebugInfo/GSYM/ExtractRanges.h"
 #include "llvm/Support/Error.h"
+#include <vector>
 
 namespace llvm {
 
@@ -76,7 +77,14 @@ private:
   /// information.
   ///
   /// \param Die The DWARF debug info entry to parse.
-  void handleDie(raw_ostream &Strm, CUInfo &CUI, DWARFDie Die);
+  ///
+  /// \param Funcs The vector that collects the FunctionInfo objects created
+  /// for this compile unit. Callers hand the whole batch to the GsymCreator
+  /// when the compile unit is done, which keeps lock traffic on the shared
+  /// function list to one acquisition per compile unit when converting with
+  /// multiple threads.
+  void handleDie(raw_ostream &Strm, CUInfo &CUI, DWARFDie Die,
+                 std::vector<FunctionInfo> &Funcs);
 
   DWARFContext &DICtx;
   raw_ostream &Log;
@@ -196,6 +196,17 @@ public:
   /// \param   FI The function info object to emplace into our functions list.
   void addFunctionInfo(FunctionInfo &&FI);
 
+  /// Add a batch of function infos to this GSYM creator.
+  ///
+  /// Equivalent to calling GsymCreator::addFunctionInfo(...) on each element,
+  /// but takes the internal mutex only once. Producers that create many
+  /// FunctionInfo objects on worker threads (such as per compile unit DWARF
+  /// conversion) should accumulate locally and add them with this function to
+  /// avoid serializing on the lock.
+  ///
+  /// \param   FIs The function info objects to move into our functions list.
+  void addFunctionInfos(std::vector<FunctionInfo> &&FIs);
+
   /// Finalize the data in the GSYM creator prior to saving the data out.
   ///
   /// Finalize must be called after all FunctionInfo objects have been added
@@ -68,7 +68,12 @@ private:
   void registerSymbolsWithAddr(TargetFAddr ImplAddr,
                                SymbolNameSet likelySymbols) {
     std::lock_guard<std::mutex> Lockit(ConcurrentAccess);
-    GlobalSpecMap.insert({ImplAddr, std::move(likelySymbols)});
+    // Merge with any candidates already registered for this address, so that
+    // clients can feed likely callees incrementally (e.g. as profile data
+    // arrives) without dropping earlier registrations.
+    auto &Likelies = GlobalSpecMap[ImplAddr];
+    for (auto &Sym : likelySymbols)
+      Likelies.insert(Sym);
   }
 
   void launchCompile(JITTargetAddress FAddr) {
@@ -136,6 +141,11 @@ public:
   // destination of __orc_speculate_for jump
   void speculateFor(TargetFAddr StubAddr) { launchCompile(StubAddr); }
 
+  // Register likely callees for each function in \p Candidates. This is the
+  // feed-in point for caller-callee graphs: IRSpeculationLayer uses it with
+  // candidates derived from IR, and clients may call it directly (and
+  // repeatedly) with externally computed likelihoods, e.g. from profile data.
+  // Candidates registered for a function that is already known are merged.
   // FIXME : Register with Stub Address, after JITLink Fix.
   void registerSymbols(FunctionCandidatesMap Candidates, JITDylib *JD) {
     for (auto &SymPair : Candidates) {
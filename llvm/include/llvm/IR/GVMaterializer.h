@@ -36,6 +36,14 @@ public:
   ///
   virtual Error materialize(GlobalValue *GV) = 0;
 
+  /// Returns true if GV has been materialized and can be dematerialized back
+  /// to whatever backing store this materializer reads from.
+  virtual bool isDematerializable(const GlobalValue *GV) const { return false; }
+
+  /// Release the memory for the body of GV, if isDematerializable(GV). A
+  /// subsequent materialize(GV) re-reads the body from the backing store.
+  virtual void dematerialize(GlobalValue *GV) {}
+
   /// Make sure the entire Module has been completely read.
   ///
   virtual Error materializeModule() = 0;
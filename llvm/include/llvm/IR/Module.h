@@ -536,6 +536,14 @@ public:
   /// Make sure the GlobalValue is fully read.
   llvm::Error materialize(GlobalValue *GV);
 
+  /// Returns true if GV's body has been materialized and the Materializer can
+  /// release it and re-read it later.
+  bool isDematerializable(const GlobalValue *GV) const;
+
+  /// Release the memory for GV's body if isDematerializable(GV). The body is
+  /// re-read from the Materializer's backing store on the next materialize().
+  void dematerialize(GlobalValue *GV);
+
   /// Make sure all GlobalValues in this Module are fully read and clear the
   /// Materializer.
   llvm::Error materializeAll();
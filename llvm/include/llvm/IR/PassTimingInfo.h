@@ -99,6 +99,29 @@ private:
   void runAfterPass(StringRef PassID);
 };
 
+/// This class reports pass execution to the -time-trace profiler
+/// (llvm/Support/TimeProfiler.h): every pass and analysis run becomes an
+/// event in the Chrome trace. The profiler records into a per-thread
+/// in-memory event buffer using a monotonic clock read per event, so unlike
+/// TimePassesHandler (which pays rusage syscalls on every start/stop) this
+/// is cheap enough to leave registered whenever time-trace output was
+/// requested for the compilation.
+class TimeProfilingPassesHandler {
+public:
+  TimeProfilingPassesHandler() = default;
+
+  void registerCallbacks(PassInstrumentationCallbacks &PIC);
+
+  // We intend this to be unique per-compilation, thus no copies.
+  TimeProfilingPassesHandler(const TimeProfilingPassesHandler &) = delete;
+  void operator=(const TimeProfilingPassesHandler &) = delete;
+
+private:
+  // Implementation of pass instrumentation callbacks.
+  void runBeforePass(StringRef PassID);
+  void runAfterPass();
+};
+
 } // namespace llvm
 
 #endif
@@ -43,6 +43,11 @@ class ToolOutputFile;
 ///
 /// This is done for correctness (if value exported, ensure we always
 /// emit a copy), and compile-time optimization (allow drop of duplicates).
+///
+/// The index is processed in parallel: \p isPrevailing may be invoked
+/// concurrently and must not mutate shared state. Calls to
+/// \p recordNewLinkage are serialized internally, but their order is
+/// unspecified.
 void thinLTOResolvePrevailingInIndex(
     const lto::Config &C, ModuleSummaryIndex &Index,
     function_ref<bool(GlobalValue::GUID, const GlobalValueSummary *)>
@@ -54,6 +59,9 @@ void thinLTOResolvePrevailingInIndex(
 /// Update the linkages in the given \p Index to mark exported values
 /// as external and non-exported values as internal. The ThinLTO backends
 /// must apply the changes to the Module via thinLTOInternalizeModule.
+///
+/// The index is processed in parallel: \p isExported and \p isPrevailing may
+/// be invoked concurrently and must not mutate shared state.
 void thinLTOInternalizeAndPromoteInIndex(
     ModuleSummaryIndex &Index,
     function_ref<bool(StringRef, ValueInfo)> isExported,
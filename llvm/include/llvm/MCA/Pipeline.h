@@ -47,6 +47,17 @@ class HWEventListener;
 /// Internally, the Pipeline collects statistical information in the form of
 /// histograms. For example, it tracks how the dispatch group size changes
 /// over time.
+///
+/// The pipeline need not receive its whole input up front. A custom SourceMgr
+/// may report hasNext() == false while isEnd() is still false, which makes
+/// the fetch stage raise InstStreamPause; run() then returns with the
+/// pipeline Paused, preserving all in-flight state, and can be called again
+/// once the source has more instructions. Together with HWEventListeners
+/// flushing their counts on whatever window boundary they choose, this is
+/// the intended way to drive a simulation from an unbounded trace; note that
+/// descriptor construction already amortizes across such a trace, since
+/// InstrBuilder caches one InstrDesc per opcode (variant scheduling classes
+/// excepted, as their resolution depends on the operands).
 class Pipeline {
   Pipeline(const Pipeline &P) = delete;
   Pipeline &operator=(const Pipeline &P) = delete;
@@ -471,6 +471,16 @@ void ELFObjectFile<ELFT>::moveSymbolNext(DataRefImpl &Sym) const {
   ++Sym.d.b;
 }
 
+// This single pass over the section header table is the only eager work an
+// ELFObjectFile does; everything else — section contents, symbol tables,
+// relocations — stays an unvalidated view into the underlying buffer until a
+// query touches it, at which point the accessor returns Expected<> and the
+// bounds checks run. Callers that don't need the symtab pointers below can
+// skip even this pass by creating the file with InitContent = false, and
+// lld's ELF port skips this class entirely, reading ELFFile views directly.
+// A "trusted input" mode that also skips the on-touch validation would
+// save only those bounds checks while turning malformed inputs from
+// diagnostics into out-of-bounds reads, so it has been deliberately left out.
 template <class ELFT> Error ELFObjectFile<ELFT>::initContent() {
   auto SectionsOrErr = EF.sections();
   if (!SectionsOrErr)
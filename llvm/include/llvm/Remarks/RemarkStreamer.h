@@ -31,6 +31,7 @@
 #define LLVM_REMARKS_REMARKSTREAMER_H
 
 #include "llvm/ADT/Optional.h"
+#include "llvm/ADT/StringMap.h"
 #include "llvm/Remarks/RemarkSerializer.h"
 #include "llvm/Support/Error.h"
 #include "llvm/Support/Regex.h"
@@ -44,6 +45,9 @@ namespace remarks {
 class RemarkStreamer final {
   /// The regex used to filter remarks based on the passes that emit them.
   Optional<Regex> PassFilter;
+  /// Per-pass remark counters used by the sampling mode; empty unless
+  /// -remarks-sample-period is in effect.
+  StringMap<uint64_t> SampleCounters;
   /// The object used to serialize the remarks to a specific format.
   std::unique_ptr<remarks::RemarkSerializer> RemarkSerializer;
   /// The filename that the remark diagnostics are emitted to.
@@ -66,6 +70,10 @@ public:
   Error setFilter(StringRef Filter);
   /// Check wether the string matches the filter.
   bool matchesFilter(StringRef Str);
+  /// Decide whether the next remark from the pass named \p PassName survives
+  /// the -remarks-sample-period sampling mode, advancing that pass's counter.
+  /// Call this at most once per remark, after the cheaper filters.
+  bool keepSample(StringRef PassName);
   /// Check if the remarks also need to have associated metadata in a section.
   bool needsSection() const;
 };
@@ -55,6 +55,14 @@ using AddStreamFn =
 using FileCache =
     std::function<Expected<AddStreamFn>(unsigned Task, StringRef Key)>;
 
+/// FileCache is deliberately a bare function type so that cache backends
+/// other than localCache — say, a client for a fleet-wide content-addressed
+/// store — can be handed to LTO without any new hooks: implement the same
+/// get-or-produce protocol over the same keys. Only the local result matters
+/// to the caller, so such a client is free to compress and upload committed
+/// artifacts asynchronously; what must stay synchronous is delivering the
+/// bytes to the link, on hit and on stream commit alike.
+
 /// This type defines the callback to add a pre-existing file (e.g. in a cache).
 ///
 /// Buffer callbacks must be thread safe.
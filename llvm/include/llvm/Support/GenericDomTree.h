@@ -254,6 +254,15 @@ protected:
   DomTreeNodeBase<NodeT> *RootNode = nullptr;
   ParentPtr Parent = nullptr;
 
+  // DFS numbers are maintained lazily: incremental updates and tree surgery
+  // only clear DFSInfoValid, queries answer through idom/level walks while it
+  // is clear, and a full renumber happens either on explicit request
+  // (updateDFSNumbers) or after enough slow queries accumulate to suggest a
+  // query-heavy phase (see the SlowQueries heuristic in dominates). Individual
+  // nodes stay individually heap-allocated rather than in a renumber-friendly
+  // array: DomTreeNode pointers are handed out to every pass and must survive
+  // arbitrary insertions and deletions, which an array layout would invalidate
+  // on growth.
   mutable bool DFSInfoValid = false;
   mutable unsigned int SlowQueries = 0;
 
@@ -16,8 +16,10 @@
 #include "llvm/Support/Threading.h"
 
 #include <algorithm>
+#include <array>
 #include <condition_variable>
 #include <functional>
+#include <memory>
 #include <mutex>
 
 namespace llvm {
@@ -130,6 +132,86 @@ void parallel_sort(RandomAccessIterator Start, RandomAccessIterator End,
 // improving to take the number of available cores into account.)
 enum { MaxTasksPerGroup = 1024 };
 
+// Out-of-place parallel LSD radix sort over an unsigned integer key, one key
+// byte per pass starting with the least significant. Each pass builds
+// per-task histograms of the key byte in parallel, converts them serially
+// into per-task scatter offsets, and scatters in parallel; every task writes
+// a disjoint set of destination slots, and ordering tasks by index within
+// each byte value keeps the sort stable. Passes where all keys share the
+// same byte (the upper bytes of mostly-small keys) are skipped.
+template <class T, class KeyFnTy>
+void parallel_radix_sort(T *Start, T *End, KeyFnTy KeyFn) {
+  using KeyTy = std::decay_t<decltype(KeyFn(*Start))>;
+  static_assert(std::is_unsigned<KeyTy>::value,
+                "radix sort requires an unsigned integer key");
+  static_assert(std::is_trivially_copyable<T>::value,
+                "radix sort scatters elements with bulk copies");
+  const size_t N = End - Start;
+  const size_t NumTasks =
+      std::min<size_t>(MaxTasksPerGroup,
+                       std::max<size_t>(N / MinParallelSize, 1));
+  const size_t TaskSize = N / NumTasks;
+  const size_t RemainingInputs = N % NumTasks;
+  // Tasks [0, RemainingInputs) process TaskSize+1 elements each.
+  auto TaskBegin = [=](size_t Id) {
+    return Id * TaskSize + std::min(Id, RemainingInputs);
+  };
+
+  // Trivially copyable elements can be scattered into uninitialized memory,
+  // so the temporary buffer does not require T to be default-constructible.
+  std::allocator<T> Alloc;
+  T *TempStorage = Alloc.allocate(N);
+  T *Src = Start, *Dst = TempStorage;
+  std::vector<std::array<size_t, 256>> Counts(NumTasks);
+
+  for (unsigned Shift = 0; Shift != 8 * sizeof(KeyTy); Shift += 8) {
+    // Build per-task histograms of the current key byte.
+    {
+      TaskGroup TG;
+      for (size_t Id = 0; Id != NumTasks; ++Id)
+        TG.spawn([=, &Counts, &KeyFn] {
+          std::array<size_t, 256> &C = Counts[Id];
+          C.fill(0);
+          for (size_t I = TaskBegin(Id), E = TaskBegin(Id + 1); I != E; ++I)
+            ++C[(KeyFn(Src[I]) >> Shift) & 0xff];
+        });
+    }
+
+    // Turn the counts into scatter offsets: elements with a smaller byte
+    // value come first, and within one byte value tasks write in index
+    // order.
+    size_t Offset = 0;
+    bool SingleBin = false;
+    for (unsigned B = 0; B != 256 && !SingleBin; ++B) {
+      size_t BinStart = Offset;
+      for (size_t Id = 0; Id != NumTasks; ++Id) {
+        size_t C = Counts[Id][B];
+        Counts[Id][B] = Offset;
+        Offset += C;
+      }
+      SingleBin = Offset - BinStart == N;
+    }
+    if (SingleBin)
+      continue;
+
+    {
+      TaskGroup TG;
+      for (size_t Id = 0; Id != NumTasks; ++Id)
+        TG.spawn([=, &Counts, &KeyFn] {
+          std::array<size_t, 256> &C = Counts[Id];
+          for (size_t I = TaskBegin(Id), E = TaskBegin(Id + 1); I != E; ++I)
+            Dst[C[(KeyFn(Src[I]) >> Shift) & 0xff]++] = Src[I];
+        });
+    }
+    std::swap(Src, Dst);
+  }
+
+  // An odd number of scatter passes leaves the result in the temporary.
+  if (Src != Start)
+    std::copy(Src, Src + N, Start);
+  Alloc.deallocate(TempStorage, N);
+}
+
 template <class IterTy, class ResultTy, class ReduceFuncTy,
           class TransformFuncTy>
 ResultTy parallel_transform_reduce(IterTy Begin, IterTy End, ResultTy Init,
@@ -193,6 +275,26 @@ void parallelSort(RandomAccessIterator Start, RandomAccessIterator End,
   llvm::sort(Start, End, Comp);
 }
 
+/// Stable sort of the contiguous range [Start, End) by an unsigned integer
+/// key computed per element by \p KeyFn. Large inputs are sorted with a
+/// parallel out-of-place radix sort, which needs the elements to be trivially
+/// copyable; small or single-threaded inputs fall back to a comparison sort
+/// on the same key. Prefer this over parallelSort when the ordering is a
+/// plain integer field, e.g. an offset or an address.
+template <class T, class KeyFnTy>
+void parallelSortByKey(T *Start, T *End, KeyFnTy KeyFn) {
+#if LLVM_ENABLE_THREADS
+  if (parallel::strategy.ThreadsRequested != 1 &&
+      End - Start >= parallel::detail::MinParallelSize) {
+    parallel::detail::parallel_radix_sort(Start, End, KeyFn);
+    return;
+  }
+#endif
+  llvm::stable_sort(Start, End, [&KeyFn](const T &A, const T &B) {
+    return KeyFn(A) < KeyFn(B);
+  });
+}
+
 void parallelFor(size_t Begin, size_t End, function_ref<void(size_t)> Fn);
 
 template <class IterTy, class FuncTy>
@@ -223,6 +325,11 @@ void parallelSort(RangeTy &&R, const Comparator &Comp = Comparator()) {
   parallelSort(std::begin(R), std::end(R), Comp);
 }
 
+template <class RangeTy, class KeyFnTy>
+void parallelSortByKey(RangeTy &&R, KeyFnTy KeyFn) {
+  parallelSortByKey(std::data(R), std::data(R) + std::size(R), KeyFn);
+}
+
 template <class RangeTy, class FuncTy>
 void parallelForEach(RangeTy &&R, FuncTy Fn) {
   parallelForEach(std::begin(R), std::end(R), Fn);
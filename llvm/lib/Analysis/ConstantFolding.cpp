@@ -54,11 +54,13 @@
 #include "llvm/Support/ErrorHandling.h"
 #include "llvm/Support/KnownBits.h"
 #include "llvm/Support/MathExtras.h"
+#include "llvm/Support/SwapByteOrder.h"
 #include <cassert>
 #include <cerrno>
 #include <cfenv>
 #include <cmath>
 #include <cstdint>
+#include <cstring>
 
 using namespace llvm;
 
@@ -499,6 +501,25 @@ bool ReadDataFromGlobal(Constant *C, uint64_t ByteOffset, unsigned char *CurPtr,
     // not reached.
   }
 
+  if (auto *CDS = dyn_cast<ConstantDataSequential>(C)) {
+    // The elements of a ConstantDataSequential are stored contiguously in
+    // host byte order with no padding, so if the host and target agree on
+    // endianness and the element type has no tail padding we can copy the
+    // requested slice wholesale instead of materializing a uniqued Constant
+    // for every element.
+    uint64_t EltSize = CDS->getElementByteSize();
+    if (DL.isLittleEndian() == sys::IsLittleEndianHost &&
+        DL.getTypeAllocSize(CDS->getElementType()) == EltSize) {
+      StringRef Data = CDS->getRawDataValues();
+      if (ByteOffset < Data.size())
+        memcpy(CurPtr, Data.data() + ByteOffset,
+               std::min<uint64_t>(BytesLeft, Data.size() - ByteOffset));
+      // Any bytes past the end of the data are tail padding or handled by
+      // the caller; *CurPtr is already zero initialized.
+      return true;
+    }
+  }
+
   if (isa<ConstantArray>(C) || isa<ConstantVector>(C) ||
       isa<ConstantDataSequential>(C)) {
     uint64_t NumElts;
@@ -225,6 +225,14 @@ int64_t MLInlineAdvisor::getLocalCalls(Function &F) {
 // number of functions and the number of static calls. We also keep track of the
 // total IR size in this module, to stop misbehaving policies at a certain bloat
 // factor (SizeIncreaseThreshold)
+//
+// Only the caller's FunctionPropertiesInfo is refreshed here (the callee's
+// is unchanged or deleted), and refreshing means one rescan of the caller.
+// Narrowing that to the inlined region would need the properties analysis
+// to support windowed updates. Batching model inference over all of an
+// SCC's call sites is not an option at all: each decision changes the
+// caller features the next decision must see, so the policy is sequential
+// by construction and one tensor per SCC would score stale state.
 void MLInlineAdvisor::onSuccessfulInlining(const MLInlineAdvice &Advice,
                                            bool CalleeWasDeleted) {
   assert(!ForceStop);
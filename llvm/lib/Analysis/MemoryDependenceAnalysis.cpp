@@ -186,6 +186,12 @@ MemDepResult MemoryDependenceResults::getCallDependencyFrom(
     BasicBlock *BB) {
   unsigned Limit = getDefaultBlockScanLimit();
 
+  // The IR cannot change for the duration of this scan, so batch the alias
+  // queries: the same (Call, Loc) and call-pair queries recur as the walk
+  // revisits equivalent locations, like the pointer-dependency scans already
+  // do via their BatchAA parameter.
+  BatchAAResults BatchAA(AA);
+
   // Walk backwards through the block, looking for dependencies.
   while (ScanIt != BB->begin()) {
     Instruction *Inst = &*--ScanIt;
@@ -204,14 +210,14 @@ MemDepResult MemoryDependenceResults::getCallDependencyFrom(
     ModRefInfo MR = GetLocation(Inst, Loc, TLI);
     if (Loc.Ptr) {
       // A simple instruction.
-      if (isModOrRefSet(AA.getModRefInfo(Call, Loc)))
+      if (isModOrRefSet(BatchAA.getModRefInfo(Call, Loc)))
         return MemDepResult::getClobber(Inst);
       continue;
     }
 
     if (auto *CallB = dyn_cast<CallBase>(Inst)) {
       // If these two calls do not interfere, look past it.
-      if (isNoModRef(AA.getModRefInfo(Call, CallB))) {
+      if (isNoModRef(BatchAA.getModRefInfo(Call, CallB))) {
         // If the two calls are the same, return Inst as a Def, so that
         // Call can be found redundant and eliminated.
         if (isReadOnlyCall && !isModSet(MR) &&
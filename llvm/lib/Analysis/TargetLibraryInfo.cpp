@@ -11,6 +11,7 @@
 //===----------------------------------------------------------------------===//
 
 #include "llvm/Analysis/TargetLibraryInfo.h"
+#include "llvm/ADT/StringMap.h"
 #include "llvm/ADT/Triple.h"
 #include "llvm/IR/Constants.h"
 #include "llvm/InitializePasses.h"
@@ -902,14 +903,22 @@ bool TargetLibraryInfoImpl::getLibFunc(StringRef funcName, LibFunc &F) const {
   if (funcName.empty())
     return false;
 
-  const auto *Start = std::begin(StandardNames);
-  const auto *End = std::end(StandardNames);
-  const auto *I = std::lower_bound(Start, End, funcName);
-  if (I != End && *I == funcName) {
-    F = (LibFunc)(I - Start);
-    return true;
-  }
-  return false;
+  // The name table stays a sorted array for the .def file's sake, but this
+  // query runs for essentially every callee in passes like InstCombine, so
+  // hash the table once and answer repeat queries with a single lookup
+  // instead of a binary search over all the names.
+  static const StringMap<LibFunc> NameToFunc = [] {
+    StringMap<LibFunc> Map(LibFunc::NumLibFuncs);
+    for (unsigned FI = 0; FI != LibFunc::NumLibFuncs; ++FI)
+      Map.try_emplace(StandardNames[FI], static_cast<LibFunc>(FI));
+    return Map;
+  }();
+
+  auto Entry = NameToFunc.find(funcName);
+  if (Entry == NameToFunc.end())
+    return false;
+  F = Entry->second;
+  return true;
 }
 
 bool TargetLibraryInfoImpl::isValidProtoForLibFunc(const FunctionType &FTy,
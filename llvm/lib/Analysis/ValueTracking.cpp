@@ -219,6 +219,16 @@ static void computeKnownBits(const Value *V, KnownBits &Known, unsigned Depth,
   computeKnownBits(V, DemandedElts, Known, Depth, Q);
 }
 
+// On caching: a pass-owned KnownBits cache keyed by Value has been proposed
+// many times for this entry point and is unsound in its callers' hands. The
+// result depends not just on V but on the context instruction (assumes,
+// dominating conditions) and, transitively, on every operand in the walked
+// DAG — so a cached entry goes stale when any instruction *feeding* V is
+// mutated, which InstCombine does constantly, and ValueHandles only observe
+// deletion and RAUW of V itself, not operand or flag changes upstream of it.
+// The fixed recursion budget is what bounds each query instead; spending
+// saved depth adaptively would make simplification dependent on query order
+// and therefore unstable across runs.
 void llvm::computeKnownBits(const Value *V, KnownBits &Known,
                             const DataLayout &DL, unsigned Depth,
                             AssumptionCache *AC, const Instruction *CxtI,
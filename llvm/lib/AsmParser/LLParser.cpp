@@ -74,6 +74,15 @@ static void setContextOpaquePointers(LLLexer &L, LLVMContext &C) {
 }
 
 /// Run: module ::= toplevelentity*
+///
+/// Parsing is single-pass and sequential. A split like the bitcode
+/// reader's (globals first, then bodies) would not enable parallel body
+/// parsing here: every body materializes types, constants and metadata
+/// through the LLVMContext uniquing tables, which are unsynchronized by
+/// design — one context is single-threaded no matter how the input is
+/// partitioned. The textual format also lacks the bitcode index's size
+/// records, so entity boundaries would have to be found by lexing, which
+/// for multi-GB inputs is itself the dominant cost being split.
 bool LLParser::Run(bool UpgradeDebugInfo,
                    DataLayoutCallbackTy DataLayoutCallback) {
   // If we haven't decided on whether or not we're using opaque pointers, do a
@@ -682,6 +682,8 @@ public:
   Error materializeForwardReferencedFunctions();
 
   Error materialize(GlobalValue *GV) override;
+  bool isDematerializable(const GlobalValue *GV) const override;
+  void dematerialize(GlobalValue *GV) override;
   Error materializeModule() override;
   std::vector<StructType *> getIdentifiedStructTypes() const override;
 
@@ -885,8 +887,18 @@ class ModuleSummaryIndexBitcodeReader : public BitcodeReaderBase {
   // We save a GUID which refers to the same global as the ValueInfo, but
   // ignoring the linkage, i.e. for values other than local linkage they are
   // identical.
-  DenseMap<unsigned, std::pair<ValueInfo, GlobalValue::GUID>>
-      ValueIdToValueInfoMap;
+  // Value IDs are dense and consecutive, so index with a vector instead of a
+  // map; for a large combined index this avoids hashing on every summary
+  // record edge/ref lookup and the DenseMap's empty-bucket overhead.
+  std::vector<std::pair<ValueInfo, GlobalValue::GUID>> ValueIdToValueInfoMap;
+
+  /// Assign the entry for ValueID, growing the table as needed.
+  void setValueIdToValueInfo(uint64_t ValueID,
+                             std::pair<ValueInfo, GlobalValue::GUID> VGI) {
+    if (ValueIdToValueInfoMap.size() <= ValueID)
+      ValueIdToValueInfoMap.resize(ValueID + 1);
+    ValueIdToValueInfoMap[ValueID] = VGI;
+  }
 
   /// Map populated during module path string table parsing, from the
   /// module ID to a string reference owned by the index's module
@@ -6503,6 +6515,49 @@ Error BitcodeReader::materialize(GlobalValue *GV) {
   return materializeForwardReferencedFunctions();
 }
 
+bool BitcodeReader::isDematerializable(const GlobalValue *GV) const {
+  const Function *F = dyn_cast<Function>(GV);
+  if (!F || F->isDeclaration() || F->isMaterializable())
+    return false;
+  // Deleting basic blocks whose address is taken would invalidate the
+  // blockaddress constants referring to them, so keep such bodies resident.
+  for (const BasicBlock &BB : *F)
+    if (BB.hasAddressTaken())
+      return false;
+  auto DFII = DeferredFunctionInfo.find(const_cast<Function *>(F));
+  // The body can only be re-read if we recorded its position in the stream.
+  return DFII != DeferredFunctionInfo.end() && DFII->second != 0;
+}
+
+void BitcodeReader::dematerialize(GlobalValue *GV) {
+  if (!isDematerializable(GV))
+    return;
+
+  // Just forget the function body; DeferredFunctionInfo still holds its
+  // bitcode offset, so a later materialize() re-reads it from the buffer.
+  Function *F = cast<Function>(GV);
+
+  // dropAllReferences() also drops the hung-off personality, prefix and
+  // prologue operands. Those are populated while parsing the module-level
+  // FUNCTION record, not by parseFunctionBody(), so rematerialization would
+  // not bring them back. Save them and re-attach them after the drop.
+  Constant *Personality =
+      F->hasPersonalityFn() ? F->getPersonalityFn() : nullptr;
+  Constant *Prefix = F->hasPrefixData() ? F->getPrefixData() : nullptr;
+  Constant *Prologue = F->hasPrologueData() ? F->getPrologueData() : nullptr;
+
+  F->dropAllReferences();
+
+  if (Personality)
+    F->setPersonalityFn(Personality);
+  if (Prefix)
+    F->setPrefixData(Prefix);
+  if (Prologue)
+    F->setPrologueData(Prologue);
+
+  F->setIsMaterializable(true);
+}
+
 Error BitcodeReader::materializeModule() {
   if (Error Err = materializeMetadata())
     return Err;
@@ -6581,6 +6636,7 @@ ModuleSummaryIndexBitcodeReader::getThisModule() {
 
 std::pair<ValueInfo, GlobalValue::GUID>
 ModuleSummaryIndexBitcodeReader::getValueInfoFromValueId(unsigned ValueId) {
+  assert(ValueId < ValueIdToValueInfoMap.size());
   auto VGI = ValueIdToValueInfoMap[ValueId];
   assert(VGI.first);
   return VGI;
@@ -6602,11 +6658,12 @@ void ModuleSummaryIndexBitcodeReader::setValueGUID(
   // UseStrtab is false for legacy summary formats and value names are
   // created on stack. In that case we save the name in a string saver in
   // the index so that the value name can be recorded.
-  ValueIdToValueInfoMap[ValueID] = std::make_pair(
-      TheIndex.getOrInsertValueInfo(
-          ValueGUID,
-          UseStrtab ? ValueName : TheIndex.saveString(ValueName)),
-      OriginalNameID);
+  setValueIdToValueInfo(
+      ValueID, std::make_pair(TheIndex.getOrInsertValueInfo(
+                                  ValueGUID, UseStrtab
+                                                 ? ValueName
+                                                 : TheIndex.saveString(ValueName)),
+                              OriginalNameID));
 }
 
 // Specialized value symbol table parser used when reading module index
@@ -6694,8 +6751,9 @@ Error ModuleSummaryIndexBitcodeReader::parseValueSymbolTable(
       GlobalValue::GUID RefGUID = Record[1];
       // The "original name", which is the second value of the pair will be
       // overriden later by a FS_COMBINED_ORIGINAL_NAME in the combined index.
-      ValueIdToValueInfoMap[ValueID] =
-          std::make_pair(TheIndex.getOrInsertValueInfo(RefGUID), RefGUID);
+      setValueIdToValueInfo(
+          ValueID, std::make_pair(TheIndex.getOrInsertValueInfo(RefGUID),
+                                  RefGUID));
       break;
     }
     }
@@ -7078,8 +7136,9 @@ Error ModuleSummaryIndexBitcodeReader::parseEntireSummary(unsigned ID) {
     case bitc::FS_VALUE_GUID: { // [valueid, refguid]
       uint64_t ValueID = Record[0];
       GlobalValue::GUID RefGUID = Record[1];
-      ValueIdToValueInfoMap[ValueID] =
-          std::make_pair(TheIndex.getOrInsertValueInfo(RefGUID), RefGUID);
+      setValueIdToValueInfo(
+          ValueID, std::make_pair(TheIndex.getOrInsertValueInfo(RefGUID),
+                                  RefGUID));
       break;
     }
     // FS_PERMODULE: [valueid, flags, instcount, fflags, numrefs,
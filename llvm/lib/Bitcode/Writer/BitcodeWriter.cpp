@@ -3348,6 +3348,17 @@ void ModuleBitcodeWriter::writeUseListBlock(const Function *F) {
 }
 
 /// Emit a function body to the module stream.
+///
+/// Function blocks are emitted strictly in sequence. The abbreviations they
+/// use are not the bottleneck for that: they are defined once per module in
+/// the BLOCKINFO block (see writeBlockInfo) and shared by every
+/// FUNCTION_BLOCK. What actually serializes the loop is the ValueEnumerator:
+/// incorporateFunction/purgeFunction extend and roll back one shared
+/// numbering, so each function's record operands depend on enumerator state
+/// mutated in emission order. Emitting bodies into per-thread buffers would
+/// mean snapshotting that state per worker (the module-level tables are the
+/// bulk of it) before the word-aligned subblocks could be spliced; that
+/// memory/time trade has not been worth it so far.
 void ModuleBitcodeWriter::writeFunction(
     const Function &F,
     DenseMap<const Function *, uint64_t> &FunctionToBitcodeIndex) {
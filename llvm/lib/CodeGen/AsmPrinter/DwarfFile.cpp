@@ -54,6 +54,25 @@ void DwarfFile::emitUnit(DwarfUnit *TheU, bool UseOffsets) {
 }
 
 // Compute the size and offset for each DIE.
+//
+// This is the first half of a two-pass scheme: size every unit here, then
+// emit them all in emitUnits(). The passes cannot be fused into a streaming
+// emitter that discards each DIE after writing it, even though that would
+// lower peak memory on debug-heavy TUs:
+//
+// - DIEEntry values refer to DIE objects, and with DW_FORM_ref_addr the
+//   referent may live in a unit that is sized (and emitted) after the
+//   referring one, so every tree must stay alive until the last unit is
+//   written.
+// - Unit headers carry the unit length, which is only known once the whole
+//   unit has been sized; emitting a unit before its sizing walk finishes
+//   would require patching the object stream.
+// - All DIE values share DwarfDebug's bump allocator, so individual trees
+//   cannot be freed piecemeal anyway.
+//
+// Shrinking peak RSS here would mean giving units their own allocators and
+// resolving cross-unit references symbolically, which is a rework of DIE
+// ownership rather than a change to this walk.
 void DwarfFile::computeSizeAndOffsets() {
   // Offset from the first CU in the debug info section is 0 initially.
   uint64_t SecOffset = 0;
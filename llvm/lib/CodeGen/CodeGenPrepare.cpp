@@ -5223,6 +5223,14 @@ bool CodeGenPrepare::optimizeMemoryInst(Instruction *MemoryInst, Value *Addr,
   // done this for some other load/store instr in this block.  If so, reuse
   // the computation.  Before attempting reuse, check if the address is valid
   // as it may have been erased.
+  //
+  // Note this cache deliberately keys the *sunk IR* by address value rather
+  // than memoizing matcher verdicts by (base, GEP shape): a matched AddrMode
+  // is also a function of the access type, address space and which
+  // address-computation instructions are profitable to sink for this
+  // particular use, so two loads with the same-shaped GEP can legitimately
+  // match different modes. Reusing the materialized address below is what
+  // removes the RAUW churn without baking those per-use inputs into a key.
 
   WeakTrackingVH SunkAddrVH = SunkAddrs[Addr];
 
@@ -38,6 +38,17 @@ cl::OptionCategory GICombinerOptionCategory(
 );
 } // end namespace llvm
 
+// On reordering combine rules by observed hit frequency: the rule order in
+// the generated tryCombineAll is part of each combiner's semantics — an
+// earlier rule that fires hides later ones for that instruction, so sorting
+// rules by profile data can change the emitted code, not just the matcher's
+// speed. Per-rule hit counts for tuning a target's .td ordering by hand can
+// be had today from -debug-only=gi-combiner plus the rule-disable options
+// registered above, which accept the same rule identifiers. Making the
+// *host* compiler lay out hot match code together (the cold-rule outlining
+// part of this idea) is what building LLVM itself with PGO/BOLT does, and
+// needs no matcher infrastructure.
+
 namespace {
 /// This class acts as the glue the joins the CombinerHelper to the overall
 /// Combine algorithm. The CombinerHelper is intended to report the
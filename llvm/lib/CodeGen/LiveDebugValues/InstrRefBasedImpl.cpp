@@ -3187,6 +3187,32 @@ bool InstrRefBasedLDV::ExtendRanges(MachineFunction &MF,
   if (AdjustsStackInCalls)
     StackProbeSymbolName = STI.getTargetLowering()->getStackProbeSymbolName(MF);
 
+  // Both limits have to be exceeded before range extension is disabled, and
+  // that has to be decided before anything is allocated: the machine-value
+  // tables below are dense in blocks times locations, and for pathological
+  // functions the allocation itself is what exhausts memory, not the
+  // dataflow solving. Count DBG_VALUE / DBG_INSTR_REF instructions as a
+  // cheap upper bound for the variable assignment count.
+  int MaxNumBlocks = -1;
+  unsigned NumDebugInstrs = 0;
+  for (auto &MBB : MF) {
+    MaxNumBlocks = std::max(MBB.getNumber(), MaxNumBlocks);
+    for (const MachineInstr &MI : MBB)
+      if (MI.isDebugValue() || MI.isDebugRef())
+        ++NumDebugInstrs;
+  }
+  assert(MaxNumBlocks >= 0);
+  ++MaxNumBlocks;
+
+  if ((unsigned)MaxNumBlocks > InputBBLimit &&
+      NumDebugInstrs > InputDbgValLimit) {
+    LLVM_DEBUG(dbgs() << "Disabling InstrRefBasedLDV: " << MF.getName()
+                      << " has " << MaxNumBlocks << " basic blocks and "
+                      << NumDebugInstrs
+                      << " debug value instructions, exceeding limits.\n");
+    return false;
+  }
+
   MTracker =
       new MLocTracker(MF, *TII, *TRI, *MF.getSubtarget().getTargetLowering());
   VTracker = nullptr;
@@ -3196,12 +3222,6 @@ bool InstrRefBasedLDV::ExtendRanges(MachineFunction &MF,
   SmallVector<VLocTracker, 8> vlocs;
   LiveInsT SavedLiveIns;
 
-  int MaxNumBlocks = -1;
-  for (auto &MBB : MF)
-    MaxNumBlocks = std::max(MBB.getNumber(), MaxNumBlocks);
-  assert(MaxNumBlocks >= 0);
-  ++MaxNumBlocks;
-
   initialSetup(MF);
 
   MLocTransfer.resize(MaxNumBlocks);
@@ -3278,7 +3298,6 @@ bool InstrRefBasedLDV::ExtendRanges(MachineFunction &MF,
 
   // To mirror old LiveDebugValues, enumerate variables in RPOT order. Otherwise
   // the order is unimportant, it just has to be stable.
-  unsigned VarAssignCount = 0;
   for (unsigned int I = 0; I < OrderToBB.size(); ++I) {
     auto *MBB = OrderToBB[I];
     auto *VTracker = &vlocs[MBB->getNumber()];
@@ -3296,29 +3315,15 @@ bool InstrRefBasedLDV::ExtendRanges(MachineFunction &MF,
       ScopeToVars[Scope].insert(Var);
       ScopeToAssignBlocks[Scope].insert(VTracker->MBB);
       ScopeToDILocation[Scope] = ScopeLoc;
-      ++VarAssignCount;
     }
   }
 
-  bool Changed = false;
-
-  // If we have an extremely large number of variable assignments and blocks,
-  // bail out at this point. We've burnt some time doing analysis already,
-  // however we should cut our losses.
-  if ((unsigned)MaxNumBlocks > InputBBLimit &&
-      VarAssignCount > InputDbgValLimit) {
-    LLVM_DEBUG(dbgs() << "Disabling InstrRefBasedLDV: " << MF.getName()
-                      << " has " << MaxNumBlocks << " basic blocks and "
-                      << VarAssignCount
-                      << " variable assignments, exceeding limits.\n");
-  } else {
-    // Optionally, solve the variable value problem and emit to blocks by using
-    // a lexical-scope-depth search. It should be functionally identical to
-    // the "else" block of this condition.
-    Changed = depthFirstVLocAndEmit(
-        MaxNumBlocks, ScopeToDILocation, ScopeToVars, ScopeToAssignBlocks,
-        SavedLiveIns, MOutLocs, MInLocs, vlocs, MF, AllVarsNumbering, *TPC);
-  }
+  // The pathological-input bail out already happened up front, before the
+  // value tables were allocated, so solve the variable value problem and
+  // emit to blocks using a lexical-scope-depth search.
+  bool Changed = depthFirstVLocAndEmit(
+      MaxNumBlocks, ScopeToDILocation, ScopeToVars, ScopeToAssignBlocks,
+      SavedLiveIns, MOutLocs, MInLocs, vlocs, MF, AllVarsNumbering, *TPC);
 
   delete MTracker;
   delete TTracker;
@@ -746,40 +746,25 @@ VNInfo *LiveRange::MergeValueNumberInto(VNInfo *V1, VNInfo *V2) {
     std::swap(V1, V2);
   }
 
-  // Merge V1 segments into V2.
-  for (iterator I = begin(); I != end(); ) {
-    iterator S = I++;
-    if (S->valno != V1) continue;  // Not a V1 Segment.
-
-    // Okay, we found a V1 live range.  If it had a previous, touching, V2 live
-    // range, extend it.
-    if (S != begin()) {
-      iterator Prev = S-1;
-      if (Prev->valno == V2 && Prev->end == S->start) {
-        Prev->end = S->end;
-
-        // Erase this live-range.
-        segments.erase(S);
-        I = Prev+1;
-        S = Prev;
-      }
-    }
-
-    // Okay, now we have a V1 or V2 live range that is maximally merged forward.
-    // Ensure that it is a V2 live-range.
-    S->valno = V2;
-
-    // If we can merge it into later V2 segments, do so now.  We ignore any
-    // following V1 segments, as they will be merged in subsequent iterations
-    // of the loop.
-    if (I != end()) {
-      if (I->start == S->end && I->valno == V2) {
-        S->end = I->end;
-        segments.erase(I);
-        I = S+1;
+  // Merge V1 segments into V2 in one pass, compacting the vector in place:
+  // rewrite V1 segments to V2 and coalesce any segment that now touches a
+  // preceding V2 segment into it. Erasing segments one at a time instead
+  // would be quadratic on ranges with many touching segments.
+  iterator Out = begin();
+  for (iterator I = begin(), E = end(); I != E; ++I) {
+    Segment Seg = *I;
+    if (Seg.valno == V1)
+      Seg.valno = V2;
+    if (Seg.valno == V2 && Out != begin()) {
+      iterator Prev = Out - 1;
+      if (Prev->valno == V2 && Prev->end == Seg.start) {
+        Prev->end = Seg.end;
+        continue;
       }
     }
+    *Out++ = Seg;
   }
+  segments.erase(Out, end());
 
   // Now that V1 is dead, remove it.
   markValNoForDeletion(V1);
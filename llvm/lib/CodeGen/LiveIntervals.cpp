@@ -193,6 +193,13 @@ bool LiveIntervals::computeVirtRegInterval(LiveInterval &LI) {
   return computeDeadValues(LI, nullptr);
 }
 
+// All virtual registers are computed up front rather than lazily on first
+// query. Deferral would not skip any work for register allocation: the
+// allocators seed their priority queues by walking every vreg, and a
+// queue priority is derived from the interval itself (size, spill
+// weight), so the "first touched" set is everything. Laziness would only
+// reshuffle when each interval is computed, while losing the dense
+// SlotIndex locality of computing them in vreg order.
 void LiveIntervals::computeVirtRegs() {
   for (unsigned i = 0, e = MRI->getNumVirtRegs(); i != e; ++i) {
     Register Reg = Register::index2VirtReg(i);
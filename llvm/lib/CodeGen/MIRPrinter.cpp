@@ -9,6 +9,16 @@
 // This file implements the class that prints out the LLVM IR and machine
 // functions using the MIR serialization format.
 //
+// MIR is textual on purpose, and a parallel binary encoding is a larger
+// commitment than it looks: machine IR has no stability guarantee — opcode
+// numbers, register and regclass enums, and target flag bits are private to
+// each target and shift with every TableGen change, so a binary format
+// would either bake those numbers in (breaking on any backend change, which
+// defeats checkpoint/migrate uses) or name-mangle them per record (at which
+// point it stops being meaningfully smaller than the text). The embedded
+// LLVM IR module can already be emitted as bitcode; the MIR layer rides on
+// names because names are the only stable identifiers it has.
+//
 //===----------------------------------------------------------------------===//
 
 #include "llvm/CodeGen/MIRPrinter.h"
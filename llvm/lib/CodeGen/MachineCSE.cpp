@@ -102,6 +102,14 @@ namespace {
     }
 
   private:
+    // Hashing goes through MachineInstrExpressionTrait, which walks the
+    // operands on every lookup. A per-function hash cache kept up to date by
+    // MachineFunction would need a mutation-notification channel that the
+    // MI representation does not have — operands are edited in place by any
+    // pass holding a MachineOperand reference, with no hook to invalidate a
+    // stored hash, so a cached value can silently go stale. The operand
+    // walk is also what makes a hit trustworthy: isIdenticalTo must run on
+    // collisions regardless.
     using AllocatorTy = RecyclingAllocator<BumpPtrAllocator,
                             ScopedHashTableVal<MachineInstr *, unsigned>>;
     using ScopedHTType =
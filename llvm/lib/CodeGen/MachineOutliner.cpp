@@ -528,6 +528,14 @@ void MachineOutliner::emitOutlinedFunctionRemark(OutlinedFunction &OF) {
 void MachineOutliner::findCandidates(
     InstructionMapper &Mapper, std::vector<OutlinedFunction> &FunctionList) {
   FunctionList.clear();
+  // The suffix tree is built in one shot over the whole module's mapping.
+  // Construction is linear (Ukkonen) and cannot usefully start earlier in
+  // the pipeline: the mapped sequence is over post-RA instructions, which
+  // do not exist when functions finish ISel. The expensive part of this
+  // loop is the target's getOutliningCandidateInfo queries; they inspect
+  // live MachineFunction state and the legal-candidate sets they produce
+  // feed the sequential greedy selection below, so scoring on worker
+  // threads would race with both.
   SuffixTree ST(Mapper.UnsignedVec);
 
   // First, find all of the repeated substrings in the tree of minimum length
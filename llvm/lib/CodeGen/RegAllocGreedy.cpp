@@ -2217,6 +2217,17 @@ void RAGreedy::tryHintsRecoloring() {
   }
 }
 
+// A note on memoizing these decisions: caching split/eviction choices keyed
+// by a canonicalized live-range shape looks attractive for machine-generated
+// functions full of structurally identical ranges, but the inputs to each
+// decision are not shape-local. Eviction cost depends on what currently
+// occupies the candidate registers, split points depend on SpillPlacement's
+// global block frequencies, and both change as allocation proceeds, so two
+// identical-looking ranges legitimately get different answers. The sound
+// reuse points are the ones already present: InterferenceCache memoizes
+// interference queries per (entry, physreg), and LiveRegMatrix tags cached
+// union queries with a user tag so repeated probes within one decision are
+// free.
 MCRegister RAGreedy::selectOrSplitImpl(const LiveInterval &VirtReg,
                                        SmallVectorImpl<Register> &NewVRegs,
                                        SmallVirtRegSet &FixedRegisters,
@@ -231,6 +231,17 @@ namespace {
     }
 
     /// Call the node-specific routine that folds each particular type of node.
+    ///
+    /// Two structural changes that keep being suggested for this path and why
+    /// they don't hold up. Generation stamps to skip "unchanged" nodes: a
+    /// node is re-added precisely because a neighbor changed (see
+    /// AddToWorklistWithUsers callers), and whether a combine fires depends
+    /// on those neighbors, so the node's own generation can't justify a skip
+    /// — the map above already guarantees each node is in the list at most
+    /// once. Opcode-indexed rule tables with precondition masks: visit() is a
+    /// dense switch on opcode, i.e. already a jump table, and the "manual
+    /// guards" inside each visitFoo are queries against node operands and
+    /// TLI whose answers can't be precomputed into a static mask per opcode.
     SDValue visit(SDNode *N);
 
   public:
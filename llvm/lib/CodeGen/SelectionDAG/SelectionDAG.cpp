@@ -994,6 +994,11 @@ void SDDbgInfo::add(SDDbgValue *V, bool isParameter) {
 }
 
 void SDDbgInfo::erase(const SDNode *Node) {
+  // This runs for every node the DAG deallocates, including the full
+  // per-block teardown in allnodes_clear(); skip the hash lookup in the
+  // common case of a function without debug values.
+  if (DbgValMap.empty())
+    return;
   DbgValMapType::iterator I = DbgValMap.find(Node);
   if (I == DbgValMap.end())
     return;
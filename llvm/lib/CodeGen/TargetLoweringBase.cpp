@@ -1274,6 +1274,16 @@ TargetLoweringBase::findRepresentativeClass(const TargetRegisterInfo *TRI,
 
 /// computeRegisterProperties - Once all of the register classes are added,
 /// this allows us to compute derived properties we expose.
+///
+/// This runs once per TargetLowering, and targets cache one TargetLowering
+/// per distinct subtarget feature string (see the SubtargetMap in the
+/// <Target>TargetMachine::getSubtargetImpl implementations), so the tables
+/// built here — ValueTypeActions, RegisterTypeForVT, TransformToType and the
+/// per-opcode action arrays — are already shared by every function compiled
+/// against that subtarget. The legalizers consult them as O(1) array reads
+/// per node; the per-occurrence cost there is building the replacement
+/// nodes, which depends on the operands and cannot be memoized by
+/// (opcode, VT) alone.
 void TargetLoweringBase::computeRegisterProperties(
     const TargetRegisterInfo *TRI) {
   static_assert(MVT::VALUETYPE_SIZE <= MVT::MAX_ALLOWED_VALUETYPE,
@@ -59,6 +59,14 @@ static unsigned lcm(unsigned A, unsigned B) {
   return LCM;
 }
 
+// Precompute the per-resource factors (LCM multiples) here so the scheduler's
+// per-node bookkeeping is multiplies and compares rather than divides. This,
+// together with the per-SUnit caching of resolved scheduling classes in
+// ScheduleDAGInstrs::getSchedClass, is as far as the tables can be flattened
+// ahead of time: scheduling classes with variants are resolved through
+// target predicates over instruction operands, and the resource counts
+// depend on the subtarget selected at runtime, so fully resolved per-opcode
+// tables cannot be emitted statically by TableGen.
 void TargetSchedModel::init(const TargetSubtargetInfo *TSInfo) {
   STI = TSInfo;
   SchedModel = TSInfo->getSchedModel();
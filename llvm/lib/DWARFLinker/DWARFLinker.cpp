@@ -2656,6 +2656,14 @@ Error DWARFLinker::link() {
     }
     EmitLambda();
   } else {
+    // The pipeline is deliberately two threads, not one task per CU. Analysis
+    // and cloning both funnel through the shared DeclContextTree and string
+    // pools, cloning assigns output DIE offsets and string offsets in emission
+    // order, and the streamer writes sections as cloning progresses. Going
+    // wider per CU means making the uniquing tables concurrent and switching
+    // to relocatable per-CU buffers that are patched and concatenated
+    // afterwards, i.e. a different linker architecture rather than a change
+    // to this loop.
     ThreadPool Pool(hardware_concurrency(2));
     Pool.async(AnalyzeAll);
     Pool.async(CloneAll);
@@ -539,6 +539,15 @@ Error handleSection(
   return Error::success();
 }
 
+// Inputs are merged strictly in order. The sequencing is load-bearing: each
+// unit's index entry records the running offset of its contribution in every
+// output section, the string pool deduplicates across all inputs and each
+// input's str_offsets are rewritten against the pool as it is read, so a
+// contribution's encoding depends on everything emitted before it. Workers
+// producing per-DWO spill files would still need a serial pass to assign
+// final offsets, patch str_offsets and build the indexes — the bulk of the
+// work — leaving only object parsing overlapped. Revisit if the string
+// remapping is ever split from contribution placement.
 Error write(MCStreamer &Out, ArrayRef<std::string> Inputs) {
   const auto &MCOFI = *Out.getContext().getObjectFileInfo();
   MCSection *const StrSection = MCOFI.getDwarfStrDWOSection();
@@ -494,6 +494,17 @@ Error DWARFUnit::tryExtractDIEsIfNeeded(bool CUDieOnly) {
   if (DieArray.empty())
     return Error::success();
 
+  // The pre-reservation in extractDIEsToVector assumes an average DIE size;
+  // for units with larger DIEs it can overshoot by a sizable fraction, and the
+  // slack is retained for as long as the unit's DIEs are (consumers such as
+  // llvm-symbolizer keep many units parsed at once). Copy obviously oversized
+  // arrays into exactly-sized ones; shrink_to_fit() is non-binding (see
+  // clearDIEs).
+  if (DieArray.size() > 1 && DieArray.capacity() > DieArray.size() + 64 &&
+      DieArray.capacity() - DieArray.size() > DieArray.size() / 8)
+    DieArray = std::vector<DWARFDebugInfoEntry>(DieArray.begin(),
+                                                DieArray.end());
+
   // If CU DIE was just parsed, copy several attribute values from it.
   if (HasCUDie)
     return Error::success();
@@ -349,7 +349,8 @@ static void convertFunctionLineTable(raw_ostream &Log, CUInfo &CUI,
     FI.OptLineTable = llvm::None;
 }
 
-void DwarfTransformer::handleDie(raw_ostream &OS, CUInfo &CUI, DWARFDie Die) {
+void DwarfTransformer::handleDie(raw_ostream &OS, CUInfo &CUI, DWARFDie Die,
+                                 std::vector<FunctionInfo> &Funcs) {
   switch (Die.getTag()) {
   case dwarf::DW_TAG_subprogram: {
     Expected<DWARFAddressRangesVector> RangesOrError = Die.getAddressRanges();
@@ -415,14 +416,14 @@ void DwarfTransformer::handleDie(raw_ostream &OS, CUInfo &CUI, DWARFDie Die) {
         FI.Inline->Ranges.insert(FI.Range);
         parseInlineInfo(Gsym, CUI, Die, 0, FI, *FI.Inline);
       }
-      Gsym.addFunctionInfo(std::move(FI));
+      Funcs.emplace_back(std::move(FI));
     }
   } break;
   default:
     break;
   }
   for (DWARFDie ChildDie : Die.children())
-    handleDie(OS, CUI, ChildDie);
+    handleDie(OS, CUI, ChildDie, Funcs);
 }
 
 Error DwarfTransformer::convert(uint32_t NumThreads) {
@@ -450,7 +451,9 @@ Error DwarfTransformer::convert(uint32_t NumThreads) {
     for (const auto &CU : DICtx.compile_units()) {
       DWARFDie Die = getDie(*CU);
       CUInfo CUI(DICtx, dyn_cast<DWARFCompileUnit>(CU.get()));
-      handleDie(Log, CUI, Die);
+      std::vector<FunctionInfo> Funcs;
+      handleDie(Log, CUI, Die, Funcs);
+      Gsym.addFunctionInfos(std::move(Funcs));
     }
   } else {
     // LLVM Dwarf parser is not thread-safe and we need to parse all DWARF up
@@ -479,7 +482,16 @@ Error DwarfTransformer::convert(uint32_t NumThreads) {
         pool.async([this, CUI, &LogMutex, Die]() mutable {
           std::string ThreadLogStorage;
           raw_string_ostream ThreadOS(ThreadLogStorage);
-          handleDie(ThreadOS, CUI, Die);
+          // Collect this compile unit's FunctionInfo objects locally and hand
+          // them over in one batch so the GsymCreator lock is taken once per
+          // compile unit rather than once per function. Strings and files
+          // still go through the shared tables as they are parsed, since
+          // FunctionInfo stores 32 bit offsets into those tables; sharding
+          // them per worker would require remapping every stored offset in a
+          // merge pass.
+          std::vector<FunctionInfo> Funcs;
+          handleDie(ThreadOS, CUI, Die, Funcs);
+          Gsym.addFunctionInfos(std::move(Funcs));
           ThreadOS.flush();
           if (!ThreadLogStorage.empty()) {
             // Print ThreadLogStorage lines into an actual stream under a lock
@@ -327,6 +327,14 @@ void GsymCreator::addFunctionInfo(FunctionInfo &&FI) {
   Funcs.emplace_back(std::move(FI));
 }
 
+void GsymCreator::addFunctionInfos(std::vector<FunctionInfo> &&FIs) {
+  std::lock_guard<std::mutex> Guard(Mutex);
+  for (FunctionInfo &FI : FIs) {
+    Ranges.insert(FI.Range);
+    Funcs.emplace_back(std::move(FI));
+  }
+}
+
 void GsymCreator::forEachFunctionInfo(
     std::function<bool(FunctionInfo &)> const &Callback) {
   std::lock_guard<std::mutex> Guard(Mutex);
@@ -166,6 +166,17 @@ Error StreamedHTTPResponseHandler::handleBodyChunk(StringRef BodyChunk) {
   return Error::success();
 }
 
+// Concurrency notes: each call owns its HTTPClient, so callers wanting
+// parallel prefetch can simply issue calls from multiple threads — there is
+// no shared connection state to contend on (and no cross-call connection
+// reuse either; pooling or HTTP/2 multiplexing would belong inside
+// HTTPClient). Races on one artifact are safe but not deduplicated: the
+// FileCache writes to a temporary and commits with an atomic rename, so
+// concurrent fetchers do redundant downloads and the last rename wins.
+// Tiering works through DEBUGINFOD_CACHE_PATH, which may point at shared
+// storage; anything fancier (per-host tier in front of a shared tier,
+// singleflight) is better built in the farm layer above, which can see all
+// in-flight build-ids at once.
 Expected<std::string> getCachedOrDownloadArtifact(
     StringRef UniqueKey, StringRef UrlPath, StringRef CacheDirectoryPath,
     ArrayRef<StringRef> DebuginfodUrls, std::chrono::milliseconds Timeout) {
@@ -120,6 +120,14 @@ private:
     return static_cast<const LinkerImpl &>(*this);
   }
 
+  // Fixups write only into their own block's content, so blocks are
+  // independent here in principle. The walk is still serial because the
+  // linker must honor the context's dispatch model — JITLink is frequently
+  // driven from a client thread that forbids spawning its own workers —
+  // and because applyFixup reports the first error eagerly. Sorting edges
+  // by kind to form tight per-kind loops does not pay either: edges are
+  // applied in place from the block's edge list, and the per-edge work is
+  // dominated by the target write and range check, not the kind dispatch.
   Error fixUpBlocks(LinkGraph &G) const override {
     LLVM_DEBUG(dbgs() << "Fixing up blocks:\n");
 
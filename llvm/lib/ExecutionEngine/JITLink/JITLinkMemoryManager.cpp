@@ -348,13 +348,19 @@ void InProcessMemoryManager::allocate(const JITLinkDylib *JD, LinkGraph &G,
   sys::MemoryBlock StandardSegsMem;
   sys::MemoryBlock FinalizeSegsMem;
   {
-    const sys::Memory::ProtectionFlags ReadWrite =
-        static_cast<sys::Memory::ProtectionFlags>(sys::Memory::MF_READ |
-                                                  sys::Memory::MF_WRITE);
+    unsigned SlabFlags = sys::Memory::MF_READ | sys::Memory::MF_WRITE;
+
+    // JIT'd code is hot by definition, so ask for huge pages when the slab is
+    // big enough for them to be usable. This is only a hint: platforms that
+    // can't honor it fall back to regular pages.
+    constexpr size_t HugePageSize = 2 * 1024 * 1024;
+    if (SegsSizes->total() >= HugePageSize)
+      SlabFlags |= sys::Memory::MF_HUGE_HINT;
 
     std::error_code EC;
-    Slab = sys::Memory::allocateMappedMemory(SegsSizes->total(), nullptr,
-                                             ReadWrite, EC);
+    Slab = sys::Memory::allocateMappedMemory(
+        SegsSizes->total(), nullptr,
+        static_cast<sys::Memory::ProtectionFlags>(SlabFlags), EC);
 
     if (EC) {
       OnAllocated(errorCodeToError(EC));
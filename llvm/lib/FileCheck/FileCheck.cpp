@@ -1295,7 +1295,18 @@ Pattern::MatchResult Pattern::match(StringRef Buffer,
   unsigned int Flags = Regex::Newline;
   if (IgnoreCase)
     Flags |= Regex::IgnoreCase;
-  if (!Regex(RegExToMatch, Flags).match(Buffer, &MatchInfo))
+  bool Matched;
+  if (Substitutions.empty()) {
+    // The regex text is fixed for the whole run, so compile it once and
+    // reuse it. This matters for CHECK-DAG groups, which re-match their
+    // patterns repeatedly while resolving overlaps.
+    if (!CompiledRegEx)
+      CompiledRegEx = std::make_shared<Regex>(RegExToMatch, Flags);
+    Matched = CompiledRegEx->match(Buffer, &MatchInfo);
+  } else {
+    Matched = Regex(RegExToMatch, Flags).match(Buffer, &MatchInfo);
+  }
+  if (!Matched)
     return make_error<NotFoundError>();
 
   // Successful regex match.
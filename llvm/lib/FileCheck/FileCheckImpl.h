@@ -20,8 +20,10 @@
 #include "llvm/ADT/StringRef.h"
 #include "llvm/FileCheck/FileCheck.h"
 #include "llvm/Support/Error.h"
+#include "llvm/Support/Regex.h"
 #include "llvm/Support/SourceMgr.h"
 #include <map>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -622,6 +624,13 @@ class Pattern {
   /// a fixed string to match.
   std::string RegExStr;
 
+  /// The compiled form of RegExStr, built lazily on the first match attempt.
+  /// Only used for patterns without substitutions; patterns with
+  /// substitutions get their final regex text at match time and must be
+  /// recompiled for every attempt. Held by shared_ptr because Pattern must
+  /// stay copyable and Regex is move-only.
+  mutable std::shared_ptr<Regex> CompiledRegEx;
+
   /// Entries in this vector represent a substitution of a string variable or
   /// an expression in the RegExStr regex at match time. For example, in the
   /// case of a CHECK directive with the pattern "foo[[bar]]baz[[#N+1]]",
@@ -862,10 +862,38 @@ Constant *ConstantInt::getBool(Type *Ty, bool V) {
   return V ? getTrue(Ty) : getFalse(Ty);
 }
 
+// Map the bit widths covered by LLVMContextImpl::SmallIntCache to a row of
+// the cache, or -1 if the width is not cached.
+static int getSmallIntCacheRow(unsigned BitWidth) {
+  switch (BitWidth) {
+  case 1:
+    return 0;
+  case 8:
+    return 1;
+  case 16:
+    return 2;
+  case 32:
+    return 3;
+  case 64:
+    return 4;
+  default:
+    return -1;
+  }
+}
+
 // Get a ConstantInt from an APInt.
 ConstantInt *ConstantInt::get(LLVMContext &Context, const APInt &V) {
-  // get an existing value or the insertion position
   LLVMContextImpl *pImpl = Context.pImpl;
+
+  // Common small constants bypass the uniquing map (and the APInt hashing it
+  // requires) via a direct-mapped cache.
+  int CacheRow = getSmallIntCacheRow(V.getBitWidth());
+  bool Cacheable = CacheRow >= 0 && V.ult(LLVMContextImpl::NumSmallIntCacheValues);
+  if (Cacheable)
+    if (ConstantInt *CI = pImpl->SmallIntCache[CacheRow][V.getZExtValue()])
+      return CI;
+
+  // get an existing value or the insertion position
   std::unique_ptr<ConstantInt> &Slot = pImpl->IntConstants[V];
   if (!Slot) {
     // Get the corresponding integer type for the bit width of the value.
@@ -873,6 +901,8 @@ ConstantInt *ConstantInt::get(LLVMContext &Context, const APInt &V) {
     Slot.reset(new ConstantInt(ITy, V));
   }
   assert(Slot->getType() == IntegerType::get(Context, V.getBitWidth()));
+  if (Cacheable)
+    pImpl->SmallIntCache[CacheRow][V.getZExtValue()] = Slot.get();
   return Slot.get();
 }
 
@@ -1402,6 +1402,13 @@ public:
       DenseMap<APInt, std::unique_ptr<ConstantInt>, DenseMapAPIntKeyInfo>;
   IntMapTy IntConstants;
 
+  /// Direct-mapped fast path in front of IntConstants for the integer
+  /// constants requested most often: widths 1, 8, 16, 32 and 64, values
+  /// 0 to 63. Entries are populated lazily and point into IntConstants,
+  /// which retains ownership.
+  static constexpr unsigned NumSmallIntCacheValues = 64;
+  ConstantInt *SmallIntCache[5][NumSmallIntCacheValues] = {};
+
   using FPMapTy =
       DenseMap<APFloat, std::unique_ptr<ConstantFP>, DenseMapAPFloatKeyInfo>;
   FPMapTy FPConstants;
@@ -78,8 +78,9 @@ LLVMRemarkStreamer::toRemark(const DiagnosticInfoOptimizationBase &Diag) const {
 }
 
 void LLVMRemarkStreamer::emit(const DiagnosticInfoOptimizationBase &Diag) {
-  if (!RS.matchesFilter(Diag.getPassName()))
-      return;
+  if (!RS.matchesFilter(Diag.getPassName()) ||
+      !RS.keepSample(Diag.getPassName()))
+    return;
 
   // First, convert the diagnostic to a remark.
   remarks::Remark R = toRemark(Diag);
@@ -443,6 +443,17 @@ Error Module::materialize(GlobalValue *GV) {
   return Materializer->materialize(GV);
 }
 
+bool Module::isDematerializable(const GlobalValue *GV) const {
+  if (!Materializer)
+    return false;
+  return Materializer->isDematerializable(GV);
+}
+
+void Module::dematerialize(GlobalValue *GV) {
+  if (Materializer)
+    Materializer->dematerialize(GV);
+}
+
 Error Module::materializeAll() {
   if (!Materializer)
     return Error::success();
@@ -24,6 +24,7 @@
 #include "llvm/Support/FormatVariadic.h"
 #include "llvm/Support/ManagedStatic.h"
 #include "llvm/Support/Mutex.h"
+#include "llvm/Support/TimeProfiler.h"
 #include "llvm/Support/TypeName.h"
 #include "llvm/Support/raw_ostream.h"
 #include <string>
@@ -290,4 +291,35 @@ void TimePassesHandler::registerCallbacks(PassInstrumentationCallbacks &PIC) {
       [this](StringRef P, Any) { this->runAfterPass(P); });
 }
 
+//===----------------------------------------------------------------------===//
+// Pass timing via the -time-trace profiler
+//===----------------------------------------------------------------------===//
+
+void TimeProfilingPassesHandler::registerCallbacks(
+    PassInstrumentationCallbacks &PIC) {
+  if (!timeTraceProfilerEnabled())
+    return;
+
+  // Pass managers and adaptors are deliberately not filtered out here: their
+  // events provide the nesting that makes the resulting trace readable.
+  PIC.registerBeforeNonSkippedPassCallback(
+      [this](StringRef P, Any) { this->runBeforePass(P); });
+  PIC.registerAfterPassCallback(
+      [this](StringRef P, Any, const PreservedAnalyses &) {
+        this->runAfterPass();
+      });
+  PIC.registerAfterPassInvalidatedCallback(
+      [this](StringRef P, const PreservedAnalyses &) { this->runAfterPass(); });
+  PIC.registerBeforeAnalysisCallback(
+      [this](StringRef P, Any) { this->runBeforePass(P); });
+  PIC.registerAfterAnalysisCallback(
+      [this](StringRef P, Any) { this->runAfterPass(); });
+}
+
+void TimeProfilingPassesHandler::runBeforePass(StringRef PassID) {
+  timeTraceProfilerBegin(PassID, StringRef(""));
+}
+
+void TimeProfilingPassesHandler::runAfterPass() { timeTraceProfilerEnd(); }
+
 } // namespace llvm
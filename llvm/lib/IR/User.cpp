@@ -119,6 +119,16 @@ bool User::isDroppable() const {
 //===----------------------------------------------------------------------===//
 //                         User operator new Implementations
 //===----------------------------------------------------------------------===//
+//
+// IR objects are individually heap-allocated, with the use list co-allocated
+// in front of the object (see the layout comments below). Allocating them
+// from a per-function arena instead has been considered and rejected:
+// instructions are deleted one at a time throughout the optimizer (RAUW,
+// DCE, uniquing replacement), constants and metadata referenced from a
+// function outlive it in the LLVMContext, and the co-allocation scheme
+// means every delete must know how the object was allocated. A transparent
+// arena therefore can't reclaim anything until the whole function dies,
+// which is exactly the case the context-per-module pattern already covers.
 
 void *User::allocateFixedOperandUser(size_t Size, unsigned Us,
                                      unsigned DescBytes) {
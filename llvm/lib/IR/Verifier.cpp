@@ -6218,6 +6218,14 @@ bool llvm::verifyFunction(const Function &f, raw_ostream *OS) {
 
 bool llvm::verifyModule(const Module &M, raw_ostream *OS,
                         bool *BrokenDebugInfo) {
+  // Note on parallelizing this loop: function bodies are not verified
+  // independently. A single Verifier instance is reused so that module-level
+  // metadata reachable from many functions (in particular debug info graphs)
+  // is only visited once via the MDNodes cache, and the global-value and
+  // attachment checks accumulate state across functions. Sharding functions
+  // over threads would either race on those caches or give up the sharing
+  // that makes verification of metadata-heavy modules affordable.
+  //
   // Don't use a raw_null_ostream.  Printing IR is expensive.
   Verifier V(OS, /*ShouldTreatBrokenDebugInfoAsError=*/!BrokenDebugInfo, M);
 
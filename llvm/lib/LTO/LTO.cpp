@@ -40,6 +40,7 @@
 #include "llvm/Support/FileSystem.h"
 #include "llvm/Support/ManagedStatic.h"
 #include "llvm/Support/MemoryBuffer.h"
+#include "llvm/Support/Parallel.h"
 #include "llvm/Support/Path.h"
 #include "llvm/Support/SHA1.h"
 #include "llvm/Support/SourceMgr.h"
@@ -57,6 +58,7 @@
 #include "llvm/Transforms/Utils/FunctionImportUtils.h"
 #include "llvm/Transforms/Utils/SplitModule.h"
 
+#include <mutex>
 #include <set>
 
 using namespace llvm;
@@ -65,6 +67,9 @@ using namespace object;
 
 #define DEBUG_TYPE "lto"
 
+STATISTIC(NumThinLTOCacheHits, "Number of ThinLTO backend cache hits");
+STATISTIC(NumThinLTOCacheMisses, "Number of ThinLTO backend cache misses");
+
 static cl::opt<bool>
     DumpThinCGSCCs("dump-thin-cg-sccs", cl::init(false), cl::Hidden,
                    cl::desc("Dump the SCCs in the ThinLTO index's callgraph"));
@@ -412,10 +417,30 @@ void llvm::thinLTOResolvePrevailingInIndex(
       if (auto AS = dyn_cast<AliasSummary>(S.get()))
         GlobalInvolvedWithAlias.insert(&AS->getAliasee());
 
+  // Each GUID's resolution only touches its own summary list, and both
+  // GlobalInvolvedWithAlias and the isPrevailing callback are read-only here,
+  // so the per-GUID work can run concurrently. recordNewLinkage typically
+  // writes into caller-owned maps, so serialize the calls to it; each
+  // (module, GUID) pair is recorded at most once, making the call order
+  // immaterial. The index map has no random access, so gather the ValueInfos
+  // up front.
+  std::vector<ValueInfo> GUIDs;
+  GUIDs.reserve(Index.size());
   for (auto &I : Index)
-    thinLTOResolvePrevailingGUID(C, Index.getValueInfo(I),
-                                 GlobalInvolvedWithAlias, isPrevailing,
-                                 recordNewLinkage, GUIDPreservedSymbols);
+    GUIDs.push_back(Index.getValueInfo(I));
+
+  std::mutex RecordMutex;
+  auto recordNewLinkageLocked = [&](StringRef ModulePath,
+                                    GlobalValue::GUID GUID,
+                                    GlobalValue::LinkageTypes NewLinkage) {
+    std::lock_guard<std::mutex> Guard(RecordMutex);
+    recordNewLinkage(ModulePath, GUID, NewLinkage);
+  };
+
+  parallelForEach(GUIDs, [&](ValueInfo VI) {
+    thinLTOResolvePrevailingGUID(C, VI, GlobalInvolvedWithAlias, isPrevailing,
+                                 recordNewLinkageLocked, GUIDPreservedSymbols);
+  });
 }
 
 static bool isWeakObjectWithRWAccess(GlobalValueSummary *GVS) {
@@ -461,9 +486,17 @@ void llvm::thinLTOInternalizeAndPromoteInIndex(
     function_ref<bool(StringRef, ValueInfo)> isExported,
     function_ref<bool(GlobalValue::GUID, const GlobalValueSummary *)>
         isPrevailing) {
+  // As with prevailing resolution above, linkage updates stay within each
+  // GUID's own summary list and the callbacks only read shared state, so the
+  // GUIDs can be processed concurrently.
+  std::vector<ValueInfo> GUIDs;
+  GUIDs.reserve(Index.size());
   for (auto &I : Index)
-    thinLTOInternalizeAndPromoteGUID(Index.getValueInfo(I), isExported,
-                                     isPrevailing);
+    GUIDs.push_back(Index.getValueInfo(I));
+
+  parallelForEach(GUIDs, [&](ValueInfo VI) {
+    thinLTOInternalizeAndPromoteGUID(VI, isExported, isPrevailing);
+  });
 }
 
 // Requires a destructor for std::vector<InputModule>.
@@ -1282,9 +1315,12 @@ public:
     if (Error Err = CacheAddStreamOrErr.takeError())
       return Err;
     AddStreamFn &CacheAddStream = *CacheAddStreamOrErr;
-    if (CacheAddStream)
+    if (CacheAddStream) {
+      ++NumThinLTOCacheMisses;
       return RunThinBackend(CacheAddStream);
+    }
 
+    ++NumThinLTOCacheHits;
     return Error::success();
   }
 
@@ -1542,7 +1578,10 @@ Error LTO::runThinLTO(AddStreamFn AddStream, FileCache Cache,
 
   auto isPrevailing = [&](GlobalValue::GUID GUID,
                           const GlobalValueSummary *S) {
-    return ThinLTO.PrevailingModuleForGUID[GUID] == S->modulePath();
+    // Use a read-only lookup: this callback runs concurrently from the
+    // parallel index updates below, and operator[] would insert a default
+    // entry for GUIDs that never prevailed anywhere.
+    return ThinLTO.PrevailingModuleForGUID.lookup(GUID) == S->modulePath();
   };
   thinLTOInternalizeAndPromoteInIndex(ThinLTO.CombinedIndex, isExported,
                                       isPrevailing);
@@ -381,6 +381,17 @@ typedef DenseMap<const Metadata *, TrackingMDRef> MDMapT;
 
 /// This is responsible for keeping track of the state used for moving data
 /// from SrcM to DstM.
+// Threading the mapping loop has been examined for full-LTO links dominated
+// by debug-info cloning and doesn't work from this layer: every mapped node
+// is created in the destination LLVMContext, whose uniquing tables, MDString
+// map, and type tables are unsynchronized shared state, and "distinct"
+// metadata subgraphs are rarely disjoint in practice (they converge on the
+// same DITypes, DIFiles, and scopes within a couple of edges). What keeps
+// repeated work down instead is SharedMDs below — source nodes whose mapping
+// is already known map in O(1) across all modules of one IRMover — and the
+// uniqued-node identity fast path in MapMetadata. Cross-module sharing of
+// already-linked DISubprogram trees without walking them would require a
+// stable cross-context identity for metadata, which LLVM does not have.
 class IRLinker {
   Module &DstM;
   std::unique_ptr<Module> SrcM;
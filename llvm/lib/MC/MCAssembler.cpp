@@ -8,6 +8,7 @@
 
 #include "llvm/MC/MCAssembler.h"
 #include "llvm/ADT/ArrayRef.h"
+#include "llvm/ADT/STLExtras.h"
 #include "llvm/ADT/SmallString.h"
 #include "llvm/ADT/SmallVector.h"
 #include "llvm/ADT/Statistic.h"
@@ -833,15 +834,37 @@ void MCAssembler::layout(MCAsmLayout &Layout) {
       Frag.setLayoutOrder(FragmentIndex++);
   }
 
+  // Collect the sections that can take part in relaxation. A section whose
+  // fragments all have layout-independent sizes can never change once laid
+  // out: fragment offsets only depend on the sizes of prior fragments in the
+  // same section. Such sections (plain data, string tables, ...) are laid out
+  // lazily on first use and skipped by the fixed-point iteration below.
+  auto IsLayoutDependent = [](const MCFragment &F) {
+    switch (F.getKind()) {
+    case MCFragment::FT_Data:
+    case MCFragment::FT_CompactEncodedInst:
+    case MCFragment::FT_Align:
+    case MCFragment::FT_Nops:
+    case MCFragment::FT_SymbolId:
+      return false;
+    default:
+      return true;
+    }
+  };
+  SmallVector<MCSection *, 16> RelaxableSections;
+  for (MCSection &Sec : *this)
+    if (llvm::any_of(Sec, IsLayoutDependent))
+      RelaxableSections.push_back(&Sec);
+
   // Layout until everything fits.
-  while (layoutOnce(Layout)) {
+  while (layoutOnce(Layout, RelaxableSections)) {
     if (getContext().hadError())
       return;
     // Size of fragments in one section can depend on the size of fragments in
     // another. If any fragment has changed size, we have to re-layout (and
-    // as a result possibly further relax) all.
-    for (MCSection &Sec : *this)
-      Layout.invalidateFragmentsFrom(&*Sec.begin());
+    // as a result possibly further relax) all sections that can change.
+    for (MCSection *Sec : RelaxableSections)
+      Layout.invalidateFragmentsFrom(&*Sec->begin());
   }
 
   DEBUG_WITH_TYPE("mc-dump", {
@@ -1212,12 +1235,12 @@ bool MCAssembler::layoutSectionOnce(MCAsmLayout &Layout, MCSection &Sec) {
   return false;
 }
 
-bool MCAssembler::layoutOnce(MCAsmLayout &Layout) {
+bool MCAssembler::layoutOnce(MCAsmLayout &Layout, ArrayRef<MCSection *> Secs) {
   ++stats::RelaxationSteps;
 
   bool WasRelaxed = false;
-  for (MCSection &Sec : *this) {
-    while (layoutSectionOnce(Layout, Sec))
+  for (MCSection *Sec : Secs) {
+    while (layoutSectionOnce(Layout, *Sec))
       WasRelaxed = true;
   }
 
@@ -398,6 +398,14 @@ static void writeSymbolTableHeader(raw_ostream &Out, object::Archive::Kind Kind,
   }
 }
 
+// Note on the format: a hash-indexed (sorted-hash plus offset) auxiliary
+// symbol table that linkers could binary-search in place has been proposed
+// to skip per-link archive indexing. It is deliberately not emitted here.
+// The classic index layout is fixed by the GNU/BSD/Big archive formats that
+// other tools (GNU ar, ranlib, ld.bfd, gold) read and rewrite, and an extra
+// special member confuses those rewriters. It would also go unread by lld,
+// which ignores archive indexes altogether and instead lazy-parses every
+// member once, as if --start-lib/--end-lib had been used.
 static void writeSymbolTable(raw_ostream &Out, object::Archive::Kind Kind,
                              bool Deterministic, ArrayRef<MemberData> Members,
                              StringRef StringTable,
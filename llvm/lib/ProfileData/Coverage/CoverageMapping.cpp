@@ -343,6 +343,19 @@ static Error handleMaybeNoDataFoundError(Error E) {
       });
 }
 
+// Loading decodes every coverage record in the object and merges it with the
+// profile before any query runs; per-file queries afterwards are already
+// O(records in that file) thanks to FilenameHash2RecordIndices. That makes
+// the load the only per-invocation cost worth amortizing, and the supported
+// way to amortize it is to keep one CoverageMapping alive and ask it about
+// many files (as llvm-cov's report/export paths do) rather than respawning
+// the tool per file. Persisting the post-merge state as an on-disk index has
+// been considered and not pursued: it would be a third versioned artifact
+// whose validity depends on both the covmap format and the profile contents,
+// and invalidation bugs there are silent wrong coverage rather than a load
+// error. Parallelizing this loop over readers is also constrained:
+// loadFunctionRecord appends to shared filename and record tables, so
+// records must land in deterministic order.
 Expected<std::unique_ptr<CoverageMapping>>
 CoverageMapping::load(ArrayRef<StringRef> ObjectFilenames,
                       StringRef ProfileFilename, ArrayRef<StringRef> Arches,
@@ -829,12 +829,27 @@ std::error_code SampleProfileReaderExtBinaryBase::readFuncProfiles() {
           if (std::error_code EC = readFuncProfile(FuncProfileAddr))
             return EC;
         }
+      } else if (!Remapper) {
+        // The profile normally holds far more functions than the module
+        // being compiled, so look the module's functions up in the offset
+        // table directly. Non-CS contexts are plain function names, which
+        // makes this an exact-match lookup.
+        for (auto Name : FuncsToUse) {
+          auto iter = FuncOffsetTable.find(SampleContext(Name));
+          if (iter == FuncOffsetTable.end())
+            continue;
+          const uint8_t *FuncProfileAddr = Start + iter->second;
+          assert(FuncProfileAddr < End && "out of LBRProfile section");
+          if (std::error_code EC = readFuncProfile(FuncProfileAddr))
+            return EC;
+        }
       } else {
+        // With a remapper any profile name may map onto a module function,
+        // so every table entry has to be considered.
         for (auto NameOffset : FuncOffsetTable) {
           SampleContext FContext(NameOffset.first);
           auto FuncName = FContext.getName();
-          if (!FuncsToUse.count(FuncName) &&
-              (!Remapper || !Remapper->exist(FuncName)))
+          if (!FuncsToUse.count(FuncName) && !Remapper->exist(FuncName))
             continue;
           const uint8_t *FuncProfileAddr = Start + NameOffset.second;
           assert(FuncProfileAddr < End && "out of LBRProfile section");
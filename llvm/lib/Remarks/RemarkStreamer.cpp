@@ -23,6 +23,12 @@ static cl::opt<cl::boolOrDefault> EnableRemarksSection(
         "this is enabled for the following formats: yaml-strtab, bitstream."),
     cl::init(cl::BOU_UNSET), cl::Hidden);
 
+static cl::opt<unsigned> RemarkSamplePeriod(
+    "remarks-sample-period",
+    cl::desc("Keep only every Nth remark per pass, after the pass filter has "
+             "been applied. 0 or 1 keeps every remark."),
+    cl::init(0), cl::Hidden);
+
 RemarkStreamer::RemarkStreamer(
     std::unique_ptr<remarks::RemarkSerializer> RemarkSerializer,
     Optional<StringRef> FilenameIn)
@@ -46,6 +52,12 @@ bool RemarkStreamer::matchesFilter(StringRef Str) {
   return true;
 }
 
+bool RemarkStreamer::keepSample(StringRef PassName) {
+  if (RemarkSamplePeriod <= 1)
+    return true;
+  return SampleCounters[PassName]++ % RemarkSamplePeriod == 0;
+}
+
 bool RemarkStreamer::needsSection() const {
   if (EnableRemarksSection == cl::BOU_TRUE)
     return true;
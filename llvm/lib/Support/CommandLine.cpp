@@ -145,6 +145,16 @@ raw_ostream &operator<<(raw_ostream &OS, const PrintArg& Arg) {
   return OS;
 }
 
+// A note on lookup cost: each SubCommand keeps its options in a StringMap, so
+// registration and parse-time lookup are one hash probe per name already. A
+// perfect-hash table frozen at first parse has been considered and rejected:
+// plugins (e.g. opt -load) register cl::opts after the host's first parse, so
+// the table would need rebuilding on every late registration, and the probe it
+// saves is not where start-up time goes — that is dominated by the dynamic
+// initializers of the option globals themselves, which only moving options off
+// static storage (a per-tool change) can defer. Help and category strings are
+// string literals referenced by pointer, so nothing is "built" for -help until
+// it prints.
 class CommandLineParser {
 public:
   // Globals for name and overview of program.  Program name is not a string to
@@ -535,15 +535,23 @@ bool Parser::parseNumber(char First, Value &Out) {
 
 bool Parser::parseString(std::string &Out) {
   // leading quote was already consumed.
-  for (char C = next(); C != '"'; C = next()) {
+  for (;;) {
+    // Append the longest run of plain characters in one copy. For the common
+    // string without escapes, this is the entire body, and the scan loop
+    // vectorizes where a bounds-checked push_back per byte does not.
+    const char *Run = P;
+    while (Run != End && *Run != '"' && *Run != '\\' && (*Run & 0x1f) != *Run)
+      ++Run;
+    Out.append(P, Run);
+    P = Run;
+
+    char C = next();
+    if (LLVM_LIKELY(C == '"'))
+      return true;
     if (LLVM_UNLIKELY(P == End))
       return parseError("Unterminated string");
     if (LLVM_UNLIKELY((C & 0x1f) == C))
       return parseError("Control character in string");
-    if (LLVM_LIKELY(C != '\\')) {
-      Out.push_back(C);
-      continue;
-    }
     // Handle escape sequence.
     switch (C = next()) {
     case '"':
@@ -574,7 +582,6 @@ bool Parser::parseString(std::string &Out) {
       return parseError("Invalid escape sequence");
     }
   }
-  return true;
 }
 
 static void encodeUtf8(uint32_t Rune, std::string &Out) {
@@ -235,6 +235,16 @@ getMemoryBufferForStream(sys::fs::file_t FD, const Twine &BufferName) {
   return getMemBufferCopyImpl(Buffer, BufferName);
 }
 
+// Note for callers loading many files (linkers, dependency scanners): this
+// interface is deliberately synchronous. An asynchronous batch variant (e.g.
+// io_uring-backed on Linux, with a completion queue of buffers) has been
+// floated, but the open+stat+mmap sequence here returns before any data is
+// faulted in, so the I/O this API issues is not where cold-cache time goes;
+// the page faults land during parsing, past the submission boundary such an
+// API could cover. Tools that want to overlap I/O with work can get the
+// overlap portably by doing their getFile calls from their existing thread
+// pools, keeping this layer free of a Linux-only submission path that the
+// VFS abstraction would have to tunnel through.
 ErrorOr<std::unique_ptr<MemoryBuffer>>
 MemoryBuffer::getFile(const Twine &Filename, bool IsText,
                       bool RequiresNullTerminator, bool IsVolatile) {
@@ -117,6 +117,17 @@ void *SmallVectorBase<Size_T>::mallocForGrow(size_t MinSize, size_t TSize,
 }
 
 // Note: Moving this function into the header may cause performance regression.
+//
+// This is already the realloc path: only the first growth out of the inline
+// buffer pays malloc+memcpy, and every subsequent growth of a heap-backed
+// vector extends in place when the allocator can oblige. Types reach here
+// whenever they are trivially copy-constructible and trivially destructible
+// (see SmallVectorTemplateBase's IsPOD parameter), which is the widest
+// trivially-relocatable set detectable in standard C++ — a broader
+// "relocatable but not trivially copyable" annotation would need per-type
+// opt-in traits that LLVM's containers have so far avoided. Callers that
+// know their final size avoid this function entirely by calling reserve()
+// up front, which allocates exactly once.
 template <class Size_T>
 void SmallVectorBase<Size_T>::grow_pod(void *FirstEl, size_t MinSize,
                                        size_t TSize) {
@@ -24,6 +24,20 @@ using namespace llvm;
 
 #if LLVM_ENABLE_THREADS
 
+// A note on the single queue: a per-worker-deque work-stealing scheme has
+// come up repeatedly and been left out deliberately. The pool's clients
+// (thin-link, parallelFor via the Parallel.h executor, lld) enqueue tasks
+// that are large relative to a queue operation, so the shared lock is held
+// for a push or a pop at a time; what stealing buys is cheaper handling of
+// tasks orders of magnitude finer than these. The cost side is real:
+// stealing makes the recursive group wait() below (a worker draining another
+// group's tasks to avoid deadlock) far harder to get right, since completion
+// tracking would be spread over N deques instead of one queue. Callers who
+// measure contention here are usually enqueueing too fine; batching tasks
+// fixes that without a scheduler. Thread placement is already the
+// ThreadPoolStrategy's job (see apply_thread_strategy), which is where
+// affinity policy belongs, not on individual tasks.
+//
 // A note on thread groups: Tasks are by default in no group (represented
 // by nullptr ThreadPoolTaskGroup pointer in the Tasks queue) and functionality
 // here normally works on all tasks regardless of their group (functions
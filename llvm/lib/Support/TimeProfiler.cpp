@@ -122,6 +122,14 @@ struct llvm::TimeTraceProfiler {
 
   // Write events from this TimeTraceProfilerInstance and
   // ThreadTimeTraceProfilerInstances.
+  //
+  // Output is deliberately one self-contained JSON object per process:
+  // events carry process-relative timestamps and per-name totals are
+  // computed over the whole run, so there is no meaningful way for
+  // concurrent compiler processes to append into one shared trace file —
+  // cross-TU aggregation (e.g. ranking headers by the "Source" events
+  // clang nests per include chain) is a post-processing step over the
+  // per-TU files.
   void write(raw_pwrite_stream &OS) {
     // Acquire Mutex as reading ThreadTimeTraceProfilerInstances.
     std::lock_guard<std::mutex> Lock(Mu);
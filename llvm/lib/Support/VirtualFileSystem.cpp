@@ -253,6 +253,17 @@ namespace {
 /// A more principled approach would be to push this down a level, modelling
 /// the working dir as an llvm::sys::fs::WorkingDir or similar.
 /// This would enable the use of openat()-style functions on some platforms.
+///
+/// status() deliberately issues one syscall per query with no caching at
+/// this layer. Callers that need amortization layer it themselves with the
+/// right lifetime: clang's FileManager stats each unique path once per
+/// compilation, and the dependency scanner shares a stat/contents cache
+/// across workers. A process-spanning cache here (e.g. bulk-read directory
+/// snapshots published over shared memory) would need an invalidation
+/// protocol between unrelated build processes to avoid serving stale
+/// entries the kernel dcache would have gotten right; hermetic builds that
+/// can statically describe the tree get the same effect safely with a
+/// RedirectingFileSystem overlay (-ivfsoverlay).
 class RealFileSystem : public FileSystem {
 public:
   explicit RealFileSystem(bool LinkCWDToProcess) {
@@ -1424,6 +1424,20 @@ bool Scanner::scanFlowScalar(bool IsDoubleQuoted) {
   return true;
 }
 
+/// Returns true if \p C is printable ASCII that can neither terminate nor
+/// invalidate a plain scalar, so runs of such bytes can be consumed without
+/// the per-character checks in scanPlainScalar. Blanks, breaks and all other
+/// control characters fall out of the 0x20-0x7E range; ':' always needs a
+/// look-ahead; the flow indicators only matter inside flow context.
+static bool is_plain_safe(uint8_t C, unsigned FlowLevel) {
+  if (C < 0x20 || C > 0x7E || C == ' ' || C == ':')
+    return false;
+  if (FlowLevel && (C == ',' || C == '?' || C == '[' || C == ']' ||
+                    C == '{' || C == '}'))
+    return false;
+  return true;
+}
+
 bool Scanner::scanPlainScalar() {
   StringRef::iterator Start = Current;
   unsigned ColStart = Column;
@@ -1435,6 +1449,17 @@ bool Scanner::scanPlainScalar() {
       break;
 
     while (Current != End && !isBlankOrBreak(Current)) {
+      // Most of a typical plain scalar is printable ASCII with no special
+      // meaning; consume whole runs of it before dropping to the
+      // per-character classification below.
+      if (is_plain_safe(*Current, FlowLevel)) {
+        do {
+          ++Current;
+          ++Column;
+        } while (Current != End && is_plain_safe(*Current, FlowLevel));
+        continue;
+      }
+
       if (FlowLevel && *Current == ':' &&
           (Current + 1 == End ||
            !(isBlankOrBreak(Current + 1) || *(Current + 1) == ','))) {
@@ -734,6 +734,18 @@ static bool write_console_impl(int FD, StringRef Data) {
 }
 #endif
 
+// Syscall behavior worth knowing before adding a scatter/gather (writev)
+// layer here: small writes coalesce in the raw_ostream buffer and reach this
+// function once per buffer fill, while writes at or above the buffer size
+// bypass the buffer entirely (see raw_ostream::write) and arrive as one
+// write() straight from the caller's memory — a section copied from an input
+// mmap is already zero-copy and one syscall. Queuing non-owning spans for a
+// writev flush would only merge mid-sized writes at the cost of a lifetime
+// contract on every span, and the big-output producers (lld's writers) avoid
+// this path altogether via FileOutputBuffer, which mmaps the pre-sized
+// output. O_DIRECT is a poor fit for a general stream: it constrains user
+// buffer alignment and size to the device's, which a formatting stream can't
+// guarantee.
 void raw_fd_ostream::write_impl(const char *Ptr, size_t Size) {
   assert(FD >= 0 && "File already closed.");
   pos += Size;
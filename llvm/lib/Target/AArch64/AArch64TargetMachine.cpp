@@ -347,6 +347,15 @@ AArch64TargetMachine::AArch64TargetMachine(const Target &T, const Triple &TT,
 
   // Enable GlobalISel at or below EnableGlobalISelAt0, unless this is
   // MachO/CodeModel::Large, which GlobalISel does not support.
+  //
+  // This is AArch64's fast -O0 path: at this level the GlobalISel pipeline
+  // runs only the O0 pre-legalizer combiner (debug-info canonicalization,
+  // not an optimizer), so -O0 functions never pay SelectionDAG construction
+  // unless GlobalISel falls back on an unsupported construct — and for those
+  // fallbacks AArch64FastISel gets the first try before the full DAG does.
+  // Workloads seeing whole-block DAG selection at -O0 are hitting fallbacks,
+  // which -pass-remarks-missed=gisel-* will pinpoint; fixing the specific
+  // fallback is the intended cure, not broadening FastISel's table coverage.
   if (getOptLevel() <= EnableGlobalISelAtO &&
       TT.getArch() != Triple::aarch64_32 &&
       TT.getEnvironment() != Triple::GNUILP32 &&
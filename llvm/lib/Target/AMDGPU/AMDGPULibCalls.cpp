@@ -43,6 +43,13 @@ static cl::list<std::string> UseNative("amdgpu-use-native",
 
 namespace llvm {
 
+// This folding works on the library-call level (exact vs native variants,
+// constant folding, pow/rootn strength reduction). Uniform-argument math
+// specializations have been suggested as a further axis and are a dead end
+// on current hardware: the scalar unit has no transcendental pipes, so a
+// wave-uniform exp/log still issues as VALU ops — divergence analysis can
+// keep the operands and result in SGPRs, which the backend already exploits,
+// but there is no scalar-unit body for a "uniform variant" to call.
 class AMDGPULibCalls {
 private:
 
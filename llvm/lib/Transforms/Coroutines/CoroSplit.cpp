@@ -1897,6 +1897,21 @@ namespace {
   };
 }
 
+// Note on cloning cost: the switch ABI produces exactly three clones
+// (resume, destroy, cleanup) however many suspend points the coroutine has;
+// per-suspend dispatch happens through the switch built by
+// createResumeEntryBlock, not through extra function copies. Only the
+// continuation ABIs (async, retcon) clone once per suspend, and there each
+// clone is specialized as it is made: the entry is rewritten to branch
+// straight to that suspend's resume block, the frame pointer is rederived
+// from the continuation's own arguments, and postSplitCleanup prunes what
+// became unreachable. Cloning a pre-specialized "template" instead would not
+// remove the per-funclet CloneFunctionInto copy — each funclet needs its own
+// argument list, value map and debug-info scope — it would only add a fourth
+// copy to make the template from. Splitting independent coroutines in
+// parallel is also off the table for now: each split inserts functions into
+// the module, updates the lazy call graph, and uniques constants and
+// metadata through the shared LLVMContext, none of which is synchronized.
 static coro::Shape splitCoroutine(Function &F,
                                   SmallVectorImpl<Function *> &Clones,
                                   TargetTransformInfo &TTI,
@@ -1706,6 +1706,17 @@ void Attributor::runTillFixpoint() {
 
   // Now that all abstract attributes are collected and initialized we start
   // the abstract analysis.
+  //
+  // The loop below is a sparse, dependence-driven solver: after the seeding
+  // iteration only AAs reachable through the dependences recorded during
+  // prior updates are re-evaluated, and invalid states are propagated along
+  // required dependences without running updates at all. Hitting the
+  // iteration limit therefore indicates long optimistic dependence chains
+  // (or a genuinely large module), not dense re-evaluation. Updating
+  // independent AAs on worker threads is not an option in this design:
+  // updates freely create new AAs, record dependences in shared vectors, and
+  // query function analyses through the analysis getters, none of which is
+  // synchronized.
 
   unsigned IterationCounter = 1;
   unsigned MaxIterations =
@@ -298,6 +298,15 @@ PreservedAnalyses GlobalDCEPass::run(Module &M, ModuleAnalysisManager &MAM) {
   // means B is used to initialize A.  Finally, it propagates the liveness
   // information through the graph starting from the nodes in L. Nodes note
   // marked as alive are discarded.
+  //
+  // The graph is rebuilt from scratch on every run even though the pass may
+  // execute several times in one pipeline. Keeping it alive between runs
+  // would require hearing about every intervening IR change that adds or
+  // removes a use of a global or changes discardability — effectively a
+  // callback per global per mutation, which the pass manager has no channel
+  // for and which would cost more bookkeeping than this linear scan; the
+  // module's own use-lists already are the use-graph, and this pass only
+  // flattens them once per run.
 
   // Remove empty functions from the global ctors list.
   Changed |= optimizeGlobalCtorsList(
@@ -684,6 +684,16 @@ bool HotColdSplitting::outlineColdRegions(Function &F, bool HasProfileSummary) {
   return Changed;
 }
 
+// The per-function loop below stays sequential on purpose. The shareable
+// state is already shared and cheap: PSI is one module-level read-only
+// summary, BFI is only computed for functions that have a profile and comes
+// out of the analysis manager's cache, and the domtrees built lazily in
+// outlineColdRegions survive across all regions of a function because
+// CodeExtractor updates them in place. What can't be shared are the mutation
+// paths — every outlined region creates a function in the module and every
+// analysis query goes through a function analysis manager, neither of which
+// tolerates concurrent callers. Splitting is cheap enough per function that
+// the parallel win would sit inside analysis-manager locks anyway.
 bool HotColdSplitting::run(Module &M) {
   bool Changed = false;
   bool HasProfileSummary = (M.getProfileSummary(/* IsCS */ false) != nullptr);
@@ -143,6 +143,18 @@ PreservedAnalyses ModuleInlinerPass::run(Module &M,
   // It is possible to use other priority heuristics, e.g. profile-based
   // heuristic.
   //
+  // A stronger form of this idea -- computing call-site costs for the whole
+  // module up front (possibly in parallel) and then merely executing the
+  // resulting plan -- does not work with the current cost model. A call
+  // site's cost depends on IR produced by earlier inlining decisions:
+  // arguments become constants, callees disappear or shrink, and the
+  // thresholds consult analyses (BFI, PSI) that are invalidated as functions
+  // change. Any precomputed plan would have to be re-costed at almost every
+  // step, and the analysis managers it would query are not safe to use from
+  // multiple threads. The priority queue below is the workable middle
+  // ground: global ordering with costs computed when a call reaches the
+  // front.
+  //
   // TODO: Here is a huge amount duplicate code between the module inliner and
   // the SCC inliner, which need some refactoring.
   std::unique_ptr<InlineOrder<std::pair<CallBase *, int>>> Calls;
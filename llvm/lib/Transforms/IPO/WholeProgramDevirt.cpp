@@ -852,6 +852,14 @@ void updateVCallVisibilityInIndex(
   }
 }
 
+// The index walk below is serial, and not by accident: DevirtIndex both
+// reads and mutates the one ModuleSummaryIndex — it attaches resolutions to
+// the WPD resolution map of each type-id summary and grows ExportedGUIDs —
+// and the per-slot work draws on TypeIdCompatibleVtableMap entries that
+// aggregate summaries from every module, so there are no independent shards
+// to reduce over; the index is a single cross-module graph by construction.
+// Thin-link scaling work for CFI-wide deployments should aim at shrinking
+// what gets into the combined index, not at threading this pass.
 void runWholeProgramDevirtOnIndex(
     ModuleSummaryIndex &Summary, std::set<GlobalValue::GUID> &ExportedGUIDs,
     std::map<ValueInfo, std::vector<VTableSlotSummary>> &LocalWPDTargetsMap) {
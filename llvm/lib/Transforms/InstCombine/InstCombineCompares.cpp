@@ -6159,14 +6159,21 @@ Instruction *InstCombinerImpl::visitICmpInst(ICmpInst &I) {
     if (Instruction *Res = canonicalizeICmpBool(I, Builder))
       return Res;
 
-  if (Instruction *Res = canonicalizeCmpWithConstant(I))
-    return Res;
+  // The complexity canonicalization above put a constant operand, if any, on
+  // the RHS. Classify it once here so the constant-only fold batteries below
+  // are skipped entirely for compares of two non-constant values.
+  const bool Op1IsConstant = isa<Constant>(Op1);
+
+  if (Op1IsConstant)
+    if (Instruction *Res = canonicalizeCmpWithConstant(I))
+      return Res;
 
   if (Instruction *Res = canonicalizeICmpPredicate(I))
     return Res;
 
-  if (Instruction *Res = foldICmpWithConstant(I))
-    return Res;
+  if (Op1IsConstant)
+    if (Instruction *Res = foldICmpWithConstant(I))
+      return Res;
 
   if (Instruction *Res = foldICmpWithDominatingICmp(I))
     return Res;
@@ -6228,16 +6235,18 @@ Instruction *InstCombinerImpl::visitICmpInst(ICmpInst &I) {
   if (Instruction *Res = foldICmpBinOp(I, Q))
     return Res;
 
-  if (Instruction *Res = foldICmpInstWithConstant(I))
-    return Res;
+  if (Op1IsConstant)
+    if (Instruction *Res = foldICmpInstWithConstant(I))
+      return Res;
 
   // Try to match comparison as a sign bit test. Intentionally do this after
   // foldICmpInstWithConstant() to potentially let other folds to happen first.
   if (Instruction *New = foldSignBitTest(I))
     return New;
 
-  if (Instruction *Res = foldICmpInstWithConstantNotInt(I))
-    return Res;
+  if (Op1IsConstant)
+    if (Instruction *Res = foldICmpInstWithConstantNotInt(I))
+      return Res;
 
   // Try to optimize 'icmp GEP, P' or 'icmp P, GEP'.
   if (auto *GEP = dyn_cast<GEPOperator>(Op0))
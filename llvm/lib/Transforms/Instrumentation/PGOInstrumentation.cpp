@@ -258,6 +258,12 @@ static cl::opt<bool> PGOFunctionEntryCoverage(
     cl::desc(
         "Use this option to enable function entry coverage instrumentation."));
 
+static cl::opt<bool> PGOBlockCoverage(
+    "pgo-block-coverage", cl::Hidden,
+    cl::desc("Use single byte \"was executed\" counters instead of 64-bit"
+             " counts at the usual instrumentation points. Much cheaper to"
+             " run, but the resulting profile cannot drive optimization."));
+
 static cl::opt<bool>
     PGOFixEntryCount("pgo-fix-entry-count", cl::init(true), cl::Hidden,
                      cl::desc("Fix function entry count in profile use."));
@@ -360,6 +366,8 @@ static GlobalVariable *createIRLevelProfileFlagVar(Module &M, bool IsCS) {
   if (PGOFunctionEntryCoverage)
     ProfileVersion |=
         VARIANT_MASK_BYTE_COVERAGE | VARIANT_MASK_FUNCTION_ENTRY_ONLY;
+  if (PGOBlockCoverage)
+    ProfileVersion |= VARIANT_MASK_BYTE_COVERAGE;
   auto IRLevelVersionVariable = new GlobalVariable(
       M, IntTy64, true, GlobalValue::WeakAnyLinkage,
       Constant::getIntegerValue(IntTy64, APInt(64, ProfileVersion)), VarName);
@@ -860,10 +868,15 @@ static void instrumentOneFunc(
     IRBuilder<> Builder(InstrBB, InstrBB->getFirstInsertionPt());
     assert(Builder.GetInsertPoint() != InstrBB->end() &&
            "Cannot get the Instrumentation point");
-    // llvm.instrprof.increment(i8* <name>, i64 <hash>, i32 <num-counters>,
-    //                          i32 <index>)
+    // In block coverage mode the counters are single bytes that are only
+    // ever stored to, so place a cover intrinsic at each instrumentation
+    // point instead of an increment. The intrinsics share their operands:
+    // llvm.instrprof.{increment,cover}(i8* <name>, i64 <hash>,
+    //                                  i32 <num-counters>, i32 <index>)
     Builder.CreateCall(
-        Intrinsic::getDeclaration(M, Intrinsic::instrprof_increment),
+        Intrinsic::getDeclaration(M, PGOBlockCoverage
+                                         ? Intrinsic::instrprof_cover
+                                         : Intrinsic::instrprof_increment),
         {Name, CFGHash, Builder.getInt32(NumCounters), Builder.getInt32(I++)});
   }
 
@@ -1448,11 +1461,22 @@ void SelectInstVisitor::instrumentOneSelectInst(SelectInst &SI) {
   IRBuilder<> Builder(&SI);
   Type *Int64Ty = Builder.getInt64Ty();
   Type *I8PtrTy = Builder.getInt8PtrTy();
+  auto *Name = ConstantExpr::getBitCast(FuncNameVar, I8PtrTy);
+  // Selects still consume a counter in block coverage mode so that the
+  // counter layout and function hash match the non-coverage scheme, but the
+  // byte only records that the select was reached.
+  if (PGOBlockCoverage) {
+    Builder.CreateCall(
+        Intrinsic::getDeclaration(M, Intrinsic::instrprof_cover),
+        {Name, Builder.getInt64(FuncHash), Builder.getInt32(TotalNumCtrs),
+         Builder.getInt32(*CurCtrIdx)});
+    ++(*CurCtrIdx);
+    return;
+  }
   auto *Step = Builder.CreateZExt(SI.getCondition(), Int64Ty);
   Builder.CreateCall(
       Intrinsic::getDeclaration(M, Intrinsic::instrprof_increment_step),
-      {ConstantExpr::getBitCast(FuncNameVar, I8PtrTy),
-       Builder.getInt64(FuncHash), Builder.getInt32(TotalNumCtrs),
+      {Name, Builder.getInt64(FuncHash), Builder.getInt32(TotalNumCtrs),
        Builder.getInt32(*CurCtrIdx), Step});
   ++(*CurCtrIdx);
 }
@@ -1767,6 +1767,11 @@ PreservedAnalyses LoopInterchangePass::run(LoopNest &LN,
                                            LPMUpdater &U) {
   Function &F = *LN.getParent();
 
+  // Constructing DependenceInfo here is cheap — it just captures the analysis
+  // pointers, and all SIV/MIV work happens inside individual depends() calls.
+  // Sharing one memoized result with LoopFuse is not workable: loop-nest
+  // passes may not run function analyses through the proxy, and any cached
+  // depends() outcome would be stale once either pass rewrites a loop.
   DependenceInfo DI(&F, &AR.AA, &AR.SE, &AR.LI);
   std::unique_ptr<CacheCost> CC =
       CacheCost::getCacheCost(LN.getOutermostLoop(), AR, DI);
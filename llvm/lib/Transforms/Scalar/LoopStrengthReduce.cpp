@@ -5059,6 +5059,18 @@ void LSRInstance::SolveRecurse(SmallVectorImpl<const Formula *> &Solution,
   //    - don't compute a cost, and then compare. compare while computing a cost
   //      and bail early.
   //    - track register sets with SmallBitVector
+  //
+  // Two often-requested reworkings that don't fit:
+  //  - a wall-clock/cycle budget with "best found so far" anytime behavior:
+  //    the search is already branch-and-bound against SolutionCost, but a
+  //    time-based cutoff makes emitted code depend on machine load, and
+  //    compilations must be reproducible. The deterministic equivalent is
+  //    the search-space narrowing driven by -lsr-complexity-limit above.
+  //  - best-first with a priority queue: the cost of a partial solution is
+  //    not monotone in the number of uses covered (adding a use can reuse
+  //    registers and *lower* marginal cost), so a best-first frontier has
+  //    no admissible bound to order on and degenerates to the same
+  //    exhaustive walk with extra bookkeeping.
 
   const LSRUse &LU = Uses[Workspace.size()];
 
@@ -1850,7 +1850,16 @@ Value *SCEVExpander::expand(const SCEV *S) {
     }
   }
 
-  // Check to see if we already expanded this here.
+  // Check to see if we already expanded this here. The hoisting above is
+  // what makes this cache effective across call sites: structurally equal
+  // SCEVs requested from different points in the same loop nest are steered
+  // to the same canonical insertion point (preheader or header) first, so
+  // the (SCEV, insert point) key hits and the dominating expansion is
+  // returned instead of re-expanding. Reuse beyond that — finding any
+  // dominating prior expansion from an unrelated insert point — would need a
+  // dominance query per cached entry on every expansion; FindValueInExprValueMap
+  // below covers the remaining cases by reusing IR that ScalarEvolution
+  // already knows computes S.
   auto I = InsertedExpressions.find(std::make_pair(S, InsertPt));
   if (I != InsertedExpressions.end())
     return I->second;
@@ -2060,6 +2060,15 @@ static bool SinkCommonCodeFromPredecessors(BasicBlock *BB,
   // carry on. If we can sink an instruction but need to PHI-merge some operands
   // (because they're not identical in each instruction) we add these to
   // PHIOperands.
+  //
+  // Note the lockstep scan is not pairwise-quadratic in the predecessor
+  // count: canSinkInstructions compares every block's candidate against the
+  // first one, so each row costs O(preds) and the scan is linear in the
+  // instructions actually sunk. Hash-bucketing candidates would only help a
+  // scheme that matched instructions at *different* tail offsets across
+  // predecessors, which this transform intentionally does not attempt —
+  // sinking must preserve each block's internal order, so only lockstep
+  // rows are candidates in the first place.
   int ScanIdx = 0;
   SmallPtrSet<Value*,4> InstructionsToSink;
   DenseMap<Instruction*, SmallVector<Value*,4>> PHIOperands;
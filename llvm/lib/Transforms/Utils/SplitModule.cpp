@@ -151,7 +151,7 @@ static void findPartitions(Module &M, ClusterIDMapType &ClusterIDMap,
   llvm::for_each(M.globals(), recordGVSet);
   llvm::for_each(M.aliases(), recordGVSet);
 
-  // Assigned all GVs to merged clusters while balancing number of objects in
+  // Assigned all GVs to merged clusters while balancing the total weight of
   // each.
   auto CompareClusters = [](const std::pair<unsigned, unsigned> &a,
                             const std::pair<unsigned, unsigned> &b) {
@@ -174,14 +174,28 @@ static void findPartitions(Module &M, ClusterIDMapType &ClusterIDMap,
   SmallVector<SortType, 64> Sets;
   SmallPtrSet<const GlobalValue *, 32> Visited;
 
-  // To guarantee determinism, we have to sort SCC according to size.
-  // When size is the same, use leader's name.
+  // Weigh clusters by the number of instructions they contain rather than by
+  // the number of globals: backend time is dominated by ISel/RA on function
+  // bodies, so one large function should count for as much as many small
+  // ones. Globals without a body get a nominal weight of one.
+  auto ClusterWeight = [&GVtoClusterMap](ClusterMapType::iterator I) {
+    unsigned Weight = 0;
+    for (ClusterMapType::member_iterator MI = GVtoClusterMap.member_begin(I),
+                                         ME = GVtoClusterMap.member_end();
+         MI != ME; ++MI) {
+      if (const auto *F = dyn_cast<Function>(*MI))
+        Weight += F->getInstructionCount();
+      Weight += 1;
+    }
+    return Weight;
+  };
+
+  // To guarantee determinism, we have to sort SCC according to weight.
+  // When weight is the same, use leader's name.
   for (ClusterMapType::iterator I = GVtoClusterMap.begin(),
                                 E = GVtoClusterMap.end(); I != E; ++I)
     if (I->isLeader())
-      Sets.push_back(
-          std::make_pair(std::distance(GVtoClusterMap.member_begin(I),
-                                       GVtoClusterMap.member_end()), I));
+      Sets.push_back(std::make_pair(ClusterWeight(I), I));
 
   llvm::sort(Sets, [](const SortType &a, const SortType &b) {
     if (a.first == b.first)
@@ -208,9 +222,11 @@ static void findPartitions(Module &M, ClusterIDMapType &ClusterIDMap,
                         << ((*MI)->hasLocalLinkage() ? " l " : " e ") << "\n");
       Visited.insert(*MI);
       ClusterIDMap[*MI] = CurrentClusterID;
+      if (const auto *F = dyn_cast<Function>(*MI))
+        CurrentClusterSize += F->getInstructionCount();
       CurrentClusterSize++;
     }
-    // Add this set size to the number of entries in this cluster.
+    // Add this set weight to the weight already assigned to this cluster.
     BalancinQueue.push(std::make_pair(CurrentClusterID, CurrentClusterSize));
   }
 }
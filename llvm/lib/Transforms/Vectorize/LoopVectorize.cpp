@@ -1703,6 +1703,11 @@ private:
   /// scalarized.
   DenseMap<ElementCount, SmallPtrSet<Instruction *, 4>> ForcedScalars;
 
+  /// Caches the result of getAddressAccessSCEV for each pointer operand. The
+  /// SCEV for an address is independent of the vectorization factor, but is
+  /// queried once per candidate VF for every scalarized memory instruction.
+  DenseMap<Value *, const SCEV *> AddressAccessSCEVs;
+
   /// PHINodes of the reductions that should be expanded in-loop along with
   /// their associated chains of reduction operations, in program order from top
   /// (PHI) to bottom
@@ -6315,8 +6320,14 @@ LoopVectorizationCostModel::getMemInstScalarizationCost(Instruction *I,
   //       that it is being called from this specific place.
 
   // Figure out whether the access is strided and get the stride value
-  // if it's known in compile time
-  const SCEV *PtrSCEV = getAddressAccessSCEV(Ptr, Legal, PSE, TheLoop);
+  // if it's known in compile time. The result does not depend on VF, so
+  // compute it once per pointer and reuse it for all candidate VFs.
+  auto SCEVIt = AddressAccessSCEVs.find(Ptr);
+  if (SCEVIt == AddressAccessSCEVs.end())
+    SCEVIt = AddressAccessSCEVs
+                 .insert({Ptr, getAddressAccessSCEV(Ptr, Legal, PSE, TheLoop)})
+                 .first;
+  const SCEV *PtrSCEV = SCEVIt->second;
 
   // Get the cost of the scalar memory instruction and address computation.
   InstructionCost Cost =
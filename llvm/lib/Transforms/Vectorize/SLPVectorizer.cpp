@@ -10115,19 +10115,23 @@ bool SLPVectorizerPass::vectorizeStores(ArrayRef<StoreInst *> Stores,
   int MaxIter = MaxStoreLookup.getValue();
   SmallVector<std::pair<int, int>, 16> ConsecutiveChain(
       E, std::make_pair(E, INT_MAX));
-  SmallVector<SmallBitVector, 4> CheckedPairs(E, SmallBitVector(E, false));
+  // Pairs of store indices whose pointer distance has already been computed,
+  // stored with the smaller index first. The quadratic search below checks at
+  // most MaxIter pairs per store, so a hash set stays proportional to the
+  // number of checked pairs instead of allocating E bit vectors of E bits.
+  DenseSet<std::pair<int, int>> CheckedPairs;
   int IterCnt;
   auto &&FindConsecutiveAccess = [this, &Stores, &Tails, &IterCnt, MaxIter,
                                   &CheckedPairs,
                                   &ConsecutiveChain](int K, int Idx) {
     if (IterCnt >= MaxIter)
       return true;
-    if (CheckedPairs[Idx].test(K))
+    if (CheckedPairs.contains(
+            std::make_pair(std::min(K, Idx), std::max(K, Idx))))
       return ConsecutiveChain[K].second == 1 &&
              ConsecutiveChain[K].first == Idx;
     ++IterCnt;
-    CheckedPairs[Idx].set(K);
-    CheckedPairs[K].set(Idx);
+    CheckedPairs.insert(std::make_pair(std::min(K, Idx), std::max(K, Idx)));
     Optional<int> Diff = getPointersDiff(
         Stores[K]->getValueOperand()->getType(), Stores[K]->getPointerOperand(),
         Stores[Idx]->getValueOperand()->getType(),
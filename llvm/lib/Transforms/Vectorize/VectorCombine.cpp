@@ -73,6 +73,13 @@ public:
 private:
   Function &F;
   IRBuilder<> Builder;
+  // Cost queries are issued directly against TTI rather than through a
+  // memoization layer. The hooks are pure functions of the subtarget plus
+  // their arguments, but those arguments include shuffle masks, operand
+  // kinds and context instructions, so a cache key is most of the work the
+  // hook itself does — the underlying tables are O(1) lookups once
+  // getTypeLegalizationCost has mapped the type, and that mapping is the
+  // same small loop a key hash would have to traverse.
   const TargetTransformInfo &TTI;
   const DominatorTree &DT;
   AAResults &AA;
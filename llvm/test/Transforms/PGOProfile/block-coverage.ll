@@ -0,0 +1,48 @@
+; Test that -pgo-block-coverage places single byte cover intrinsics at the
+; MST-chosen instrumentation points (and at selects) instead of 64-bit
+; increments, and tags the profile version accordingly.
+;
+; RUN: opt < %s -passes=pgo-instr-gen -pgo-block-coverage -S \
+; RUN:   | FileCheck %s --implicit-check-not="call void @llvm.instrprof.increment"
+; RUN: opt < %s -passes=pgo-instr-gen -S | FileCheck %s --check-prefix=COUNTS
+
+; The version variable carries VARIANT_MASK_BYTE_COVERAGE (bit 60):
+; 8 | (1 << 56) | (1 << 60) = 0x1100000000000008.
+; CHECK: @__llvm_profile_raw_version = {{.*}} i64 1224979098644774920
+; COUNTS: @__llvm_profile_raw_version = {{.*}} i64 72057594037927944
+
+define i32 @foo(i1 %c, i32 %i, i32 %j) {
+; CHECK-LABEL: entry:
+entry:
+  br i1 %c, label %if.then, label %if.else
+
+; Both diamond arms consume a counter, in the same layout as the increment
+; scheme so the function hash does not change.
+; CHECK-LABEL: if.then:
+; CHECK: call void @llvm.instrprof.cover({{.*}}@__profn_foo{{.*}}, i64 [[#HASH:]], i32 3, i32 0)
+; COUNTS-LABEL: if.then:
+; COUNTS: call void @llvm.instrprof.increment({{.*}}@__profn_foo{{.*}}, i64 [[#HASH:]], i32 3, i32 0)
+if.then:
+  %add = add nsw i32 %i, 2
+  br label %if.end
+
+; CHECK-LABEL: if.else:
+; CHECK: call void @llvm.instrprof.cover({{.*}}@__profn_foo{{.*}}, i64 [[#HASH]], i32 3, i32 1)
+if.else:
+  br label %if.end
+
+; The select still takes the next counter index, but as a plain "was reached"
+; byte rather than a conditional step.
+; CHECK-LABEL: if.end:
+; CHECK: call void @llvm.instrprof.cover({{.*}}@__profn_foo{{.*}}, i64 [[#HASH]], i32 3, i32 2)
+; CHECK-NEXT: %sel = select i1
+; COUNTS-LABEL: if.end:
+; COUNTS: call void @llvm.instrprof.increment.step({{.*}}@__profn_foo{{.*}}, i64 [[#HASH]], i32 3, i32 2, i64 %{{.*}})
+if.end:
+  %retv = phi i32 [ %add, %if.then ], [ %i, %if.else ]
+  %cmp = icmp slt i32 %j, 0
+  %sel = select i1 %cmp, i32 %retv, i32 0
+  ret i32 %sel
+}
+
+; CHECK: declare void @llvm.instrprof.cover(
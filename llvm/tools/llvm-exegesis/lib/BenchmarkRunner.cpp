@@ -64,6 +64,15 @@ private:
 
   Expected<llvm::SmallVector<int64_t, 4>>
   runAndSample(const char *Counters) const override {
+    // Snippets already execute in-process (the CrashRecoveryContext below is
+    // recovery, not a fork), so the per-snippet cost is assembling the
+    // function and opening its counters. Both are kept per-snippet on
+    // purpose: a counter session shared across many snippets would either
+    // attribute one snippet's events to another or fall back to kernel
+    // multiplexing, whose time-sliced scaled estimates are exactly the noise
+    // a scheduling model cannot be tuned on. Throughput on a new SKU comes
+    // from running independent opcodes in parallel harness invocations.
+    //
     // We sum counts when there are several counters for a single ProcRes
     // (e.g. P23 on SandyBridge).
     llvm::SmallVector<int64_t, 4> CounterValues;
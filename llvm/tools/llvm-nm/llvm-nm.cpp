@@ -2452,6 +2452,14 @@ int main(int argc, char **argv) {
   if (NoDyldInfo && (AddDyldInfo || DyldInfoOnly))
     error("--no-dyldinfo can't be used with --add-dyldinfo or --dyldinfo-only");
 
+  // Many files per invocation is the supported batch mode: everything above
+  // this loop (option parsing, target registration) runs once per process.
+  // An on-disk result cache keyed by inode/mtime/options was considered for
+  // build systems that invoke nm thousands of times, and rejected: the
+  // tool's per-file work is a single mmap and symbol-table walk, cheaper
+  // than the cache's own stat+hash+read, and caching command output by file
+  // identity is the build system's job, where the dependency information
+  // actually lives.
   if (ExportSymbols)
     exportSymbolNamesFromFiles(InputFilenames);
   else
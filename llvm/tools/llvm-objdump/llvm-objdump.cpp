@@ -2971,6 +2971,15 @@ int main(int argc, char **argv) {
 
   DisasmSymbolSet.insert(DisassembleSymbols.begin(), DisassembleSymbols.end());
 
+  // Files are dumped serially, but target registration and option parsing
+  // happen once per process, so passing many objects on one command line
+  // already amortizes the startup cost that dominates one-file-per-exec
+  // driving. Dumping files on a thread pool would require routing all
+  // output through per-file buffers: the dumpers stream straight to outs()
+  // from deep inside the section/symbol walks, and disassembly within a
+  // file is order-dependent (it threads symbol and relocation iterators
+  // through the section walk), so only file-level parallelism is even
+  // plausible.
   llvm::for_each(InputFilenames, dumpInput);
 
   warnOnNoMatchForSections();
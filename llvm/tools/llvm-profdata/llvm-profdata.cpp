@@ -414,13 +414,39 @@ static void mergeInstrProfile(const WeightedFileVector &Inputs,
   } else {
     ThreadPool Pool(hardware_concurrency(NumThreads));
 
-    // Load the inputs in parallel (N/NumThreads serial steps).
-    unsigned Ctx = 0;
-    for (const auto &Input : Inputs) {
-      Pool.async(loadInput, Input, Remapper, Correlator.get(), ProfiledBinary,
-                 Contexts[Ctx].get());
-      Ctx = (Ctx + 1) % NumThreads;
+    // Shard the inputs over the contexts, balancing shards by file size so
+    // that one large profile does not queue up behind several small ones.
+    // Each shard is loaded by a single task, so the loads within it never
+    // contend for the context lock and no pool worker blocks on it.
+    std::vector<std::pair<uint64_t, const WeightedFile *>> BySize;
+    BySize.reserve(Inputs.size());
+    for (const WeightedFile &Input : Inputs) {
+      uint64_t Size;
+      if (sys::fs::file_size(Input.Filename, Size))
+        Size = 0; // Unreadable inputs are diagnosed by loadInput.
+      BySize.emplace_back(Size, &Input);
     }
+    llvm::stable_sort(BySize, [](const auto &L, const auto &R) {
+      return L.first > R.first;
+    });
+    std::vector<std::vector<const WeightedFile *>> Shards(NumThreads);
+    std::vector<uint64_t> ShardSizes(NumThreads, 0);
+    for (const auto &SizeAndInput : BySize) {
+      unsigned Min = 0;
+      for (unsigned I = 1; I < NumThreads; ++I)
+        if (ShardSizes[I] < ShardSizes[Min])
+          Min = I;
+      Shards[Min].push_back(SizeAndInput.second);
+      ShardSizes[Min] += SizeAndInput.first;
+    }
+
+    // Load the shards in parallel.
+    for (unsigned I = 0; I < NumThreads; ++I)
+      Pool.async([&, I] {
+        for (const WeightedFile *Input : Shards[I])
+          loadInput(*Input, Remapper, Correlator.get(), ProfiledBinary,
+                    Contexts[I].get());
+      });
     Pool.wait();
 
     // Merge the writer contexts together (~ lg(NumThreads) serial steps).
@@ -283,6 +283,11 @@ void CSPreInliner::run() {
   // It also helps better compress context profile to control profile
   // size, as we now only need context profile for functions going to
   // be inlined.
+  // The traversal stays sequential by construction: each inline decision
+  // merges the callee's context profile into the caller, which changes the
+  // sizes and hotness the priority queue consults when later functions are
+  // processed, so cost computation can't be hoisted into a parallel phase
+  // without deciding against stale sizes.
   for (StringRef FuncName : buildTopDownOrder()) {
     processFunction(FuncName);
   }
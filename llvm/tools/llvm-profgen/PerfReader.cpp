@@ -982,7 +982,13 @@ void PerfScriptReader::parseEventOrSample(TraceStream &TraceIt) {
 }
 
 void PerfScriptReader::parseAndAggregateTrace() {
-  // Trace line iterator
+  // Trace line iterator. The stream is consumed in one ordered pass because
+  // PERF_RECORD_MMAP2 events mutate the binary's load address mapping that
+  // every later sample's addresses are canonicalized against; sharding the
+  // trace (e.g. by process) would have to split it at mmap boundaries and
+  // carry the mapping state into each shard before the per-sample parsing —
+  // the bulk of the time here — could fan out. Sample aggregation itself is
+  // just a counter map and would merge trivially.
   TraceStream TraceIt(PerfTraceFile);
   while (!TraceIt.isAtEoF())
     parseEventOrSample(TraceIt);
@@ -479,6 +479,14 @@ int main(int argc, char **argv) {
 
   std::vector<std::string> InputAddresses = Args.getAllArgValues(OPT_INPUT);
   if (InputAddresses.empty()) {
+    // The stdin loop is the tool's long-lived server mode: clients (e.g. the
+    // sanitizer runtimes) keep one llvm-symbolizer process alive, write any
+    // number of queries down a pipe, and read each answer back after the
+    // flush below. Parsed binaries stay cached in the LLVMSymbolizer between
+    // queries, with LRU eviction against --max-cache-size (see pruneCache in
+    // symbolizeInput), so batches need not group queries by module. Pipes
+    // rather than a socket keep the protocol portable and let the client own
+    // the server's lifetime.
     const int kMaxInputStringLength = 1024;
     char InputString[kMaxInputStringLength];
 
@@ -64,6 +64,10 @@ protected:
     return SE.computeConstantDifference(LHS, RHS);
   }
 
+  static const SCEV *getExistingSCEV(ScalarEvolution &SE, Value *V) {
+    return SE.getExistingSCEV(V);
+  }
+
   static bool matchURem(ScalarEvolution &SE, const SCEV *Expr, const SCEV *&LHS,
                         const SCEV *&RHS) {
     return SE.matchURem(Expr, LHS, RHS);
@@ -893,6 +897,68 @@ TEST_F(ScalarEvolutionsTest, SCEVExitLimitForgetValue) {
   EXPECT_EQ(cast<SCEVConstant>(NewEC)->getAPInt().getLimitedValue(), 1999u);
 }
 
+TEST_F(ScalarEvolutionsTest, ForgetValueThroughUncachedIntermediate) {
+  // %u is cached as an opaque SCEVUnknown (lshr by a non-constant amount),
+  // with ranges computed from %xm's bits via computeKnownBits, while the
+  // intermediate %m is never cached at all. forgetValue(%xm) must still
+  // reach %u through %m's def-use chain.
+  LLVMContext C;
+  SMDiagnostic Err;
+  std::unique_ptr<Module> M =
+      parseAssemblyString("define i32 @f(i32 %x, i32 %k) { "
+                          "  %xm = and i32 %x, 7 "
+                          "  %m = mul i32 %xm, %xm "
+                          "  %u = lshr i32 %m, %k "
+                          "  ret i32 %u "
+                          "} ",
+                          Err, C);
+  ASSERT_TRUE(M && "Could not parse module?");
+  runWithSE(*M, "f", [](Function &F, LoopInfo &LI, ScalarEvolution &SE) {
+    auto *XM = getInstructionByName(F, "xm");
+    auto *U = getInstructionByName(F, "u");
+    SE.getSCEV(XM);
+    const SCEV *S = SE.getSCEV(U);
+    EXPECT_EQ(getExistingSCEV(SE, getInstructionByName(F, "m")), nullptr);
+    // %m is at most 7 * 7, so shifting it right cannot grow it.
+    EXPECT_TRUE(SE.getUnsignedRange(S).getUnsignedMax().ule(63));
+
+    // Widen the mask; the cached range for %u is now stale.
+    XM->setOperand(1, Constant::getAllOnesValue(XM->getType()));
+    SE.forgetValue(XM);
+    EXPECT_EQ(getExistingSCEV(SE, U), nullptr);
+    EXPECT_TRUE(
+        SE.getUnsignedRange(SE.getSCEV(U)).getUnsignedMax().isAllOnes());
+  });
+}
+
+TEST_F(ScalarEvolutionsTest, ForgetValueThroughWithOverflow) {
+  // Nothing on the path from %a to the cached %ov has a cache entry: %a is
+  // never queried and the struct-typed intrinsic call is not SCEVable.
+  // forgetValue(%a) must walk through the with.overflow call anyway, since
+  // extractvalues of it are modeled from its scalar operands.
+  LLVMContext C;
+  SMDiagnostic Err;
+  std::unique_ptr<Module> M = parseAssemblyString(
+      "declare { i32, i1 } @llvm.uadd.with.overflow.i32(i32, i32) "
+      "define i1 @f(i32 %x) { "
+      "  %a = add i32 %x, 1 "
+      "  %wo = call { i32, i1 } @llvm.uadd.with.overflow.i32(i32 %a, i32 1) "
+      "  %ov = extractvalue { i32, i1 } %wo, 1 "
+      "  ret i1 %ov "
+      "} ",
+      Err, C);
+  ASSERT_TRUE(M && "Could not parse module?");
+  runWithSE(*M, "f", [](Function &F, LoopInfo &LI, ScalarEvolution &SE) {
+    auto *A = getInstructionByName(F, "a");
+    auto *OV = getInstructionByName(F, "ov");
+    SE.getSCEV(OV);
+    EXPECT_EQ(getExistingSCEV(SE, A), nullptr);
+
+    SE.forgetValue(A);
+    EXPECT_EQ(getExistingSCEV(SE, OV), nullptr);
+  });
+}
+
 TEST_F(ScalarEvolutionsTest, SCEVAddRecFromPHIwithLargeConstants) {
   // Reference: https://reviews.llvm.org/D37265
   // Make sure that SCEV does not blow up when constructing an AddRec
@@ -255,4 +255,102 @@ TEST(BitReaderTest, MaterializeFunctionsForBlockAddrInFunctionAfter) {
   EXPECT_FALSE(verifyModule(*M, &dbgs()));
 }
 
+TEST(BitReaderTest, DematerializeFunctionRoundTrip) {
+  SmallString<1024> Mem;
+
+  LLVMContext Context;
+  std::unique_ptr<Module> M = getLazyModuleFromAssembly(
+      Context, Mem, "define i32 @f(i32 %x) {\n"
+                    "  %r = add i32 %x, 1\n"
+                    "  ret i32 %r\n"
+                    "}\n");
+  Function *F = M->getFunction("f");
+
+  // Unmaterialized functions cannot be dematerialized.
+  EXPECT_TRUE(F->empty());
+  EXPECT_FALSE(M->isDematerializable(F));
+
+  ASSERT_FALSE(F->materialize());
+  EXPECT_FALSE(F->empty());
+  EXPECT_TRUE(M->isDematerializable(F));
+  EXPECT_FALSE(verifyModule(*M, &dbgs()));
+
+  // Dematerializing drops the body and flips the function back to
+  // materializable.
+  M->dematerialize(F);
+  EXPECT_TRUE(F->empty());
+  EXPECT_TRUE(F->isMaterializable());
+  EXPECT_FALSE(verifyModule(*M, &dbgs()));
+
+  // Materializing again re-reads the body from the bitcode buffer.
+  ASSERT_FALSE(F->materialize());
+  ASSERT_FALSE(F->empty());
+  EXPECT_EQ(2u, F->getEntryBlock().size());
+  EXPECT_FALSE(verifyModule(*M, &dbgs()));
+}
+
+TEST(BitReaderTest, DematerializeFunctionWithPersonality) {
+  SmallString<1024> Mem;
+
+  LLVMContext Context;
+  std::unique_ptr<Module> M = getLazyModuleFromAssembly(
+      Context, Mem,
+      "declare i32 @__gxx_personality_v0(...)\n"
+      "declare void @mayunwind()\n"
+      "define void @eh() personality i8* bitcast (i32 (...)* "
+      "@__gxx_personality_v0 to i8*) {\n"
+      "entry:\n"
+      "  invoke void @mayunwind() to label %cont unwind label %lpad\n"
+      "cont:\n"
+      "  ret void\n"
+      "lpad:\n"
+      "  %lp = landingpad { i8*, i32 } cleanup\n"
+      "  resume { i8*, i32 } %lp\n"
+      "}\n");
+  Function *EH = M->getFunction("eh");
+
+  ASSERT_FALSE(EH->materialize());
+  ASSERT_TRUE(EH->hasPersonalityFn());
+  Constant *Personality = EH->getPersonalityFn();
+  EXPECT_TRUE(M->isDematerializable(EH));
+
+  // The personality is set up by the module-level FUNCTION record, not by
+  // the function body, so it must survive a dematerialize/materialize round
+  // trip or the landingpads come back without one.
+  M->dematerialize(EH);
+  EXPECT_TRUE(EH->empty());
+  ASSERT_TRUE(EH->hasPersonalityFn());
+  EXPECT_EQ(Personality, EH->getPersonalityFn());
+  EXPECT_FALSE(verifyModule(*M, &dbgs()));
+
+  ASSERT_FALSE(EH->materialize());
+  EXPECT_FALSE(EH->empty());
+  ASSERT_TRUE(EH->hasPersonalityFn());
+  EXPECT_EQ(Personality, EH->getPersonalityFn());
+  EXPECT_FALSE(verifyModule(*M, &dbgs()));
+}
+
+TEST(BitReaderTest, DematerializeRefusedForBlockAddressTaken) {
+  SmallString<1024> Mem;
+
+  LLVMContext Context;
+  std::unique_ptr<Module> M = getLazyModuleFromAssembly(
+      Context, Mem, "@table = constant i8* blockaddress(@func, %bb)\n"
+                    "define void @func() {\n"
+                    "  unreachable\n"
+                    "bb:\n"
+                    "  unreachable\n"
+                    "}\n");
+  Function *F = M->getFunction("func");
+
+  // @func was materialized eagerly because of the blockaddress; dropping its
+  // blocks would invalidate the blockaddress, so dematerialization must
+  // refuse it.
+  ASSERT_FALSE(F->empty());
+  EXPECT_FALSE(M->isDematerializable(F));
+  M->dematerialize(F);
+  EXPECT_FALSE(F->empty());
+  EXPECT_FALSE(verifyModule(*M, &dbgs()));
+}
+
 } // end namespace
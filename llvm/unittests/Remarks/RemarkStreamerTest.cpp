@@ -0,0 +1,66 @@
+//===- unittest/Remarks/RemarkStreamerTest.cpp - RemarkStreamer tests -----===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#include "llvm/Remarks/RemarkStreamer.h"
+#include "llvm/Remarks/RemarkSerializer.h"
+#include "llvm/Support/CommandLine.h"
+#include "llvm/Support/raw_ostream.h"
+#include "gtest/gtest.h"
+
+using namespace llvm;
+
+namespace {
+
+// -remarks-sample-period is a hidden cl::opt; poke it directly so the test
+// does not depend on command line parsing.
+static void setSamplePeriod(unsigned Period) {
+  auto &Opts = cl::getRegisteredOptions();
+  auto It = Opts.find("remarks-sample-period");
+  ASSERT_NE(It, Opts.end());
+  static_cast<cl::opt<unsigned> *>(It->second)->setValue(Period);
+}
+
+static remarks::RemarkStreamer makeStreamer(raw_ostream &OS) {
+  Expected<std::unique_ptr<remarks::RemarkSerializer>> Serializer =
+      remarks::createRemarkSerializer(remarks::Format::YAML,
+                                      remarks::SerializerMode::Separate, OS);
+  EXPECT_FALSE(errorToBool(Serializer.takeError()));
+  return remarks::RemarkStreamer(std::move(*Serializer), None);
+}
+
+TEST(RemarkStreamer, SamplePeriodDisabledKeepsAll) {
+  std::string Buf;
+  raw_string_ostream OS(Buf);
+  remarks::RemarkStreamer RS = makeStreamer(OS);
+
+  // Both 0 (the default) and 1 keep every remark.
+  for (unsigned Period : {0u, 1u}) {
+    setSamplePeriod(Period);
+    for (int I = 0; I != 10; ++I)
+      EXPECT_TRUE(RS.keepSample("pass"));
+  }
+  setSamplePeriod(0);
+}
+
+TEST(RemarkStreamer, SamplePeriodKeepsEveryNthPerPass) {
+  std::string Buf;
+  raw_string_ostream OS(Buf);
+  remarks::RemarkStreamer RS = makeStreamer(OS);
+
+  setSamplePeriod(3);
+  // Each pass has its own counter: the first remark of a pass is always
+  // kept, then every third one, regardless of how the passes interleave.
+  for (int I = 0; I != 9; ++I) {
+    EXPECT_EQ(RS.keepSample("passA"), I % 3 == 0);
+    EXPECT_EQ(RS.keepSample("passB"), I % 3 == 0);
+  }
+  EXPECT_TRUE(RS.keepSample("passC"));
+  setSamplePeriod(0);
+}
+
+} // end anonymous namespace
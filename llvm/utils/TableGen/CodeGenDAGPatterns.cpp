@@ -4739,6 +4739,17 @@ void CodeGenDAGPatterns::GenerateVariants() {
   // intentionally do not reconsider these.  Any variants of added patterns have
   // already been added.
   //
+  // Two patterns can only be isomorphic if their source patterns agree on
+  // the top-level operator, so bucket them by it and compare each variant
+  // only against its bucket. This turns the dedup scan below from quadratic
+  // in the total number of patterns into quadratic in the bucket size.
+  auto TopLevelOp = [](const TreePatternNode *N) -> const void * {
+    return N->isLeaf() ? nullptr : static_cast<const void *>(N->getOperator());
+  };
+  DenseMap<const void *, std::vector<unsigned>> PatternsByOp;
+  for (unsigned p = 0, e = PatternsToMatch.size(); p != e; ++p)
+    PatternsByOp[TopLevelOp(PatternsToMatch[p].getSrcPattern())].push_back(p);
+
   for (unsigned i = 0, e = PatternsToMatch.size(); i != e; ++i) {
     MultipleUseVarSet DepVars;
     std::vector<TreePatternNodePtr> Variants;
@@ -4767,7 +4778,7 @@ void CodeGenDAGPatterns::GenerateVariants() {
 
       // Scan to see if an instruction or explicit pattern already matches this.
       bool AlreadyExists = false;
-      for (unsigned p = 0, e = PatternsToMatch.size(); p != e; ++p) {
+      for (unsigned p : PatternsByOp[TopLevelOp(Variant.get())]) {
         // Skip if the top level predicates do not match.
         if ((i != p) && (PatternsToMatch[i].getPredicates() !=
                          PatternsToMatch[p].getPredicates()))
@@ -4784,6 +4795,7 @@ void CodeGenDAGPatterns::GenerateVariants() {
       if (AlreadyExists) continue;
 
       // Otherwise, add it to the list of patterns we have.
+      PatternsByOp[TopLevelOp(Variant.get())].push_back(PatternsToMatch.size());
       PatternsToMatch.emplace_back(
           PatternsToMatch[i].getSrcRecord(), PatternsToMatch[i].getPredicates(),
           Variant, PatternsToMatch[i].getDstPatternShared(),
@@ -50,6 +50,27 @@ private:
   llvm::StringMap<std::unique_ptr<llvm::MemoryBuffer>> cachedObjects;
 };
 
+/// An object cache that additionally persists compiled objects in a directory
+/// on disk, keyed by a hash of the module's bitcode. The directory may be
+/// shared between processes: entries are written atomically and a later
+/// process JIT-compiling a bit-identical module loads the object instead of
+/// running codegen. Only the module contents are hashed, so callers must use
+/// separate directories for different targets or codegen options.
+class OnDiskObjectCache : public SimpleObjectCache {
+public:
+  explicit OnDiskObjectCache(StringRef cacheDir);
+
+  void notifyObjectCompiled(const llvm::Module *m,
+                            llvm::MemoryBufferRef objBuffer) override;
+  std::unique_ptr<llvm::MemoryBuffer> getObject(const llvm::Module *m) override;
+
+private:
+  /// Returns the path of the cache entry for module `m`.
+  std::string getCachePath(const llvm::Module *m);
+
+  std::string cacheDir;
+};
+
 struct ExecutionEngineOptions {
   /// If `llvmModuleBuilder` is provided, it will be used to create LLVM module
   /// from the given MLIR module. Otherwise, a default `translateModuleToLLVMIR`
@@ -80,6 +101,13 @@ struct ExecutionEngineOptions {
   /// be dumped to a file via the `dumpToObjectfile` method.
   bool enableObjectCache = false;
 
+  /// If `objectCacheDir` is non-empty, an `OnDiskObjectCache` rooted at that
+  /// directory is used instead of the in-memory cache: compiled objects are
+  /// persisted there keyed by the module's content hash, and modules whose
+  /// hash is already present skip target code generation entirely. Implies
+  /// `enableObjectCache`.
+  StringRef objectCacheDir = {};
+
   /// If enable `enableGDBNotificationListener` is set, the JIT compiler will
   /// notify the llvm's global GDB notification listener.
   bool enableGDBNotificationListener = true;
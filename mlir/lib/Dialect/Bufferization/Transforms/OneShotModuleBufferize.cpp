@@ -373,6 +373,18 @@ mlir::bufferization::analyzeModuleOp(ModuleOp moduleOp,
     return failure();
 
   // Analyze ops.
+  //
+  // The walk is sequential in callee-before-caller order because each
+  // function's analysis reads the equivalence/read-write summaries of the
+  // functions it calls, and all functions write into the single funcState
+  // and module-wide aliasInfo. Call-graph siblings could in principle be
+  // analyzed concurrently with per-function state followed by a merge, but
+  // the shared BufferizationAliasInfo union-find would need to be split
+  // per function first. Memoizing verdicts for structurally identical
+  // functions is not sound at this level either: the analysis outcome
+  // depends on each function's callers via the equivalence info attached
+  // to its call sites, so two textually identical functions can bufferize
+  // differently.
   for (func::FuncOp funcOp : orderedFuncOps) {
     // No body => no analysis.
     if (funcOp.getBody().empty())
@@ -16,6 +16,8 @@
 #include "mlir/Support/FileUtilities.h"
 #include "mlir/Target/LLVMIR/Export.h"
 
+#include "llvm/ADT/StringExtras.h"
+#include "llvm/Bitcode/BitcodeWriter.h"
 #include "llvm/ExecutionEngine/JITEventListener.h"
 #include "llvm/ExecutionEngine/ObjectCache.h"
 #include "llvm/ExecutionEngine/Orc/CompileUtils.h"
@@ -29,7 +31,11 @@
 #include "llvm/MC/TargetRegistry.h"
 #include "llvm/Support/Debug.h"
 #include "llvm/Support/Error.h"
+#include "llvm/Support/FileSystem.h"
+#include "llvm/Support/FileUtilities.h"
 #include "llvm/Support/Host.h"
+#include "llvm/Support/MD5.h"
+#include "llvm/Support/Path.h"
 #include "llvm/Support/ToolOutputFile.h"
 
 #define DEBUG_TYPE "execution-engine"
@@ -96,6 +102,55 @@ void SimpleObjectCache::dumpToObjectFile(StringRef outputFilename) {
   file->keep();
 }
 
+OnDiskObjectCache::OnDiskObjectCache(StringRef cacheDir)
+    : cacheDir(cacheDir.str()) {
+  if (std::error_code ec = llvm::sys::fs::create_directories(this->cacheDir))
+    errs() << "cannot create object cache directory " << this->cacheDir << ": "
+           << ec.message() << "\n";
+}
+
+std::string OnDiskObjectCache::getCachePath(const Module *m) {
+  // Key entries by the hash of the module's bitcode, so that bit-identical
+  // modules built in different processes map to the same object.
+  llvm::SmallString<256> bitcode;
+  llvm::raw_svector_ostream os(bitcode);
+  llvm::WriteBitcodeToFile(*m, os);
+  llvm::MD5::MD5Result hash =
+      llvm::MD5::hash(llvm::arrayRefFromStringRef(os.str()));
+  llvm::SmallString<128> path(cacheDir);
+  llvm::sys::path::append(path, hash.digest() + ".o");
+  return std::string(path);
+}
+
+void OnDiskObjectCache::notifyObjectCompiled(const Module *m,
+                                             MemoryBufferRef objBuffer) {
+  SimpleObjectCache::notifyObjectCompiled(m, objBuffer);
+  std::string path = getCachePath(m);
+  // Write through a temporary so concurrent processes never observe a
+  // partially written entry.
+  if (Error err = llvm::writeFileAtomically(path + ".tmp%%%%%%", path,
+                                            objBuffer.getBuffer())) {
+    errs() << "cannot persist object for " << m->getModuleIdentifier() << ": "
+           << llvm::toString(std::move(err)) << "\n";
+  }
+}
+
+std::unique_ptr<MemoryBuffer> OnDiskObjectCache::getObject(const Module *m) {
+  if (auto obj = SimpleObjectCache::getObject(m))
+    return obj;
+  auto file = MemoryBuffer::getFile(getCachePath(m));
+  if (!file) {
+    LLVM_DEBUG(dbgs() << "No on-disk object for " << m->getModuleIdentifier()
+                      << ". Compiling.\n");
+    return nullptr;
+  }
+  LLVM_DEBUG(dbgs() << "Object for " << m->getModuleIdentifier()
+                    << " loaded from disk cache.\n");
+  // Seed the in-memory cache so dumpToObjectFile keeps working on hits.
+  SimpleObjectCache::notifyObjectCompiled(m, (*file)->getMemBufferRef());
+  return std::move(*file);
+}
+
 void ExecutionEngine::dumpToObjectFile(StringRef filename) {
   if (cache == nullptr) {
     llvm::errs() << "cannot dump ExecutionEngine object code to file: "
@@ -236,6 +291,8 @@ ExecutionEngine::create(ModuleOp m, const ExecutionEngineOptions &options) {
   auto engine = std::make_unique<ExecutionEngine>(
       options.enableObjectCache, options.enableGDBNotificationListener,
       options.enablePerfNotificationListener);
+  if (!options.objectCacheDir.empty())
+    engine->cache = std::make_unique<OnDiskObjectCache>(options.objectCacheDir);
 
   std::unique_ptr<llvm::LLVMContext> ctx(new llvm::LLVMContext);
   auto llvmModule = options.llvmModuleBuilder
@@ -228,7 +228,12 @@ LogicalResult OperationVerifier::verifyOperation(Operation &op) {
     }
   }
 
-  // Verify the nested ops that are able to be verified in parallel.
+  // Verify the nested ops that are able to be verified in parallel. This
+  // dispatches onto the MLIRContext's shared thread pool (or runs inline when
+  // multithreading is disabled), and the timing infrastructure accounts for
+  // it: timers nested from worker threads are recorded as async children and
+  // merged into the owning scope, so -mlir-timing reports parallel
+  // verification correctly.
   if (failed(failableParallelForEach(
           op.getContext(), opsWithIsolatedRegions,
           [&](Operation *op) { return verifyOpAndDominance(*op); })))
@@ -149,13 +149,18 @@ bool GreedyPatternRewriteDriver::simplify(MutableArrayRef<Region> regions) {
     worklistMap.clear();
 
     if (!config.useTopDownTraversal) {
-      // Add operations to the worklist in postorder.
+      // Add operations to the worklist in postorder. The walk visits each
+      // operation exactly once, so the deduplicating map can be filled in
+      // bulk afterwards instead of being queried per operation.
       for (auto &region : regions) {
         region.walk([&](Operation *op) {
           if (!insertKnownConstant(op))
-            addToWorklist(op);
+            worklist.push_back(op);
         });
       }
+      worklistMap.reserve(worklist.size());
+      for (size_t i = 0, e = worklist.size(); i != e; ++i)
+        worklistMap[worklist[i]] = i;
     } else {
       // Add all nested operations to the worklist in preorder.
       for (auto &region : regions) {
@@ -171,6 +176,7 @@ bool GreedyPatternRewriteDriver::simplify(MutableArrayRef<Region> regions) {
       // Reverse the list so our pop-back loop processes them in-order.
       std::reverse(worklist.begin(), worklist.end());
       // Remember the reverse index.
+      worklistMap.reserve(worklist.size());
       for (size_t i = 0, e = worklist.size(); i != e; ++i)
         worklistMap[worklist[i]] = i;
     }
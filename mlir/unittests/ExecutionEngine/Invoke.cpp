@@ -25,6 +25,8 @@
 #include "mlir/Pass/PassManager.h"
 #include "mlir/Target/LLVMIR/Dialect/LLVMIR/LLVMToLLVMIRTranslation.h"
 #include "mlir/Target/LLVMIR/Export.h"
+#include "llvm/ADT/SmallString.h"
+#include "llvm/Support/FileSystem.h"
 #include "llvm/Support/TargetSelect.h"
 #include "llvm/Support/raw_ostream.h"
 
@@ -113,6 +115,95 @@ TEST(MLIRExecutionEngine, SKIP_WITHOUT_JIT(SubtractFloat)) {
   ASSERT_EQ(result, 42.f);
 }
 
+/// JITs `moduleStr` with an on-disk object cache rooted at `cacheDir` and
+/// returns the result of invoking `@foo` on 42, or -1 on failure.
+static int jitFooWithDiskCache(StringRef moduleStr, StringRef cacheDir) {
+  DialectRegistry registry;
+  registerAllDialects(registry);
+  registerLLVMDialectTranslation(registry);
+  MLIRContext context(registry);
+  OwningOpRef<ModuleOp> module =
+      parseSourceString<ModuleOp>(moduleStr, &context);
+  EXPECT_TRUE(!!module);
+  if (!module || failed(lowerToLLVMDialect(*module)))
+    return -1;
+  ExecutionEngineOptions options;
+  options.objectCacheDir = cacheDir;
+  auto jitOrError = ExecutionEngine::create(*module, options);
+  EXPECT_TRUE(!!jitOrError);
+  if (!jitOrError) {
+    llvm::consumeError(jitOrError.takeError());
+    return -1;
+  }
+  std::unique_ptr<ExecutionEngine> jit = std::move(jitOrError.get());
+  int result = -1;
+  llvm::Error error =
+      jit->invoke("foo", 42, ExecutionEngine::Result<int>(result));
+  EXPECT_TRUE(!error);
+  if (error) {
+    llvm::consumeError(std::move(error));
+    return -1;
+  }
+  return result;
+}
+
+/// Returns the path of the only file in `dir`, or "" if it does not contain
+/// exactly one file.
+static std::string getSingleCacheEntry(StringRef dir) {
+  std::string entry;
+  std::error_code ec;
+  for (llvm::sys::fs::directory_iterator it(dir, ec), e; it != e && !ec;
+       it.increment(ec)) {
+    if (!entry.empty())
+      return "";
+    entry = it->path();
+  }
+  return ec ? "" : entry;
+}
+
+TEST(MLIRExecutionEngine, SKIP_WITHOUT_JIT(OnDiskObjectCache)) {
+  std::string addModuleStr = R"mlir(
+  func.func @foo(%arg0 : i32) -> i32 attributes { llvm.emit_c_interface } {
+    %res = arith.addi %arg0, %arg0 : i32
+    return %res : i32
+  }
+  )mlir";
+  std::string subModuleStr = R"mlir(
+  func.func @foo(%arg0 : i32) -> i32 attributes { llvm.emit_c_interface } {
+    %res = arith.subi %arg0, %arg0 : i32
+    return %res : i32
+  }
+  )mlir";
+
+  llvm::SmallString<128> cacheDir, otherDir;
+  ASSERT_FALSE(
+      llvm::sys::fs::createUniqueDirectory("mlir-object-cache", cacheDir));
+  ASSERT_FALSE(
+      llvm::sys::fs::createUniqueDirectory("mlir-object-cache", otherDir));
+
+  // The first run compiles and leaves exactly one entry in the cache.
+  EXPECT_EQ(jitFooWithDiskCache(addModuleStr, cacheDir), 84);
+  std::string addEntry = getSingleCacheEntry(cacheDir);
+  ASSERT_FALSE(addEntry.empty());
+
+  // Prove the second run links the on-disk object instead of recompiling:
+  // swap in the object of a module whose @foo subtracts and observe the
+  // changed behavior for the bit-identical "add" module.
+  EXPECT_EQ(jitFooWithDiskCache(subModuleStr, otherDir), 0);
+  std::string subEntry = getSingleCacheEntry(otherDir);
+  ASSERT_FALSE(subEntry.empty());
+  ASSERT_FALSE(llvm::sys::fs::copy_file(subEntry, addEntry));
+  EXPECT_EQ(jitFooWithDiskCache(addModuleStr, cacheDir), 0);
+
+  // A missing entry falls back to compilation and repopulates the cache.
+  ASSERT_FALSE(llvm::sys::fs::remove(addEntry));
+  EXPECT_EQ(jitFooWithDiskCache(addModuleStr, cacheDir), 84);
+  EXPECT_TRUE(llvm::sys::fs::exists(addEntry));
+
+  llvm::sys::fs::remove_directories(cacheDir);
+  llvm::sys::fs::remove_directories(otherDir);
+}
+
 TEST(NativeMemRefJit, SKIP_WITHOUT_JIT(ZeroRankMemref)) {
   OwningMemRef<float, 0> a({});
   a[{}] = 42.;
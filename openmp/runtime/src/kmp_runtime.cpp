@@ -5541,6 +5541,12 @@ __kmp_allocate_team(kmp_root_t *root, int new_nproc, int max_nproc,
 
   /* nothing available in the pool, no matter, make a new team! */
   KMP_MB();
+  /* The team descriptor (and the dispatch buffers hanging off it) lands on
+     whichever node first touches these pages, i.e. the primary thread's.
+     Replicating the hot, per-thread-written parts (t_bar, dispatch buffers)
+     per NUMA domain would need allocation and reuse via the team pool to
+     become topology-aware; until then, KMP_BARRIER_PATTERN=dist is the
+     supported way to keep barrier traffic node-local on large machines. */
   team = (kmp_team_t *)__kmp_allocate(sizeof(kmp_team_t));
 
   /* and set it up */
@@ -52,6 +52,7 @@
 #include "polly/MatmulOptimizer.h"
 #include "polly/Options.h"
 #include "polly/ScheduleTreeTransform.h"
+#include "polly/Support/GICHelper.h"
 #include "polly/Support/ISLOStream.h"
 #include "polly/Support/ISLTools.h"
 #include "llvm/ADT/Sequence.h"
@@ -107,6 +108,12 @@ static cl::opt<std::string> OuterCoincidence(
              "satisfies the coincidence constraints (yes/no)"),
     cl::Hidden, cl::init("no"), cl::cat(PollyCategory));
 
+static cl::opt<int> ScheduleComputeOut(
+    "polly-schedule-computeout",
+    cl::desc("Bound the scheduler by a maximal amount of computational steps "
+             "(0 means no bound)"),
+    cl::Hidden, cl::init(300000), cl::cat(PollyCategory));
+
 static cl::opt<int> PrevectorWidth(
     "polly-prevect-width",
     cl::desc(
@@ -837,7 +844,19 @@ static void runIslScheduleOptimizer(
     SC = SC.set_proximity(Proximity);
     SC = SC.set_validity(Validity);
     SC = SC.set_coincidence(Validity);
-    Schedule = SC.compute_schedule();
+
+    // Abort the scheduler when it takes an excessive amount of computation.
+    // The schedule will come back null and the SCoP is left untouched, which
+    // beats spending minutes on a single stencil nest. Like
+    // -polly-dependences-computeout, a value of 0 disables the bound.
+    {
+      IslMaxOperationsGuard MaxOpGuard(Ctx, ScheduleComputeOut);
+      Schedule = SC.compute_schedule();
+      LLVM_DEBUG({
+        if (MaxOpGuard.hasQuotaExceeded())
+          dbgs() << "Schedule computation exceeded the computeout quota\n";
+      });
+    }
     isl_options_set_on_error(Ctx, OnErrorStatus);
 
     ScopsRescheduled++;
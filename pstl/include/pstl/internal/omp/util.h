@@ -21,6 +21,7 @@
 #include <omp.h>
 
 #include "../parallel_backend_utils.h"
+#include "../pstl_config.h"
 #include "../unseq_backend_simd.h"
 #include "../utils.h"
 
@@ -74,8 +75,8 @@ class __buffer
     ~__buffer() { __allocator_.deallocate(__ptr_, __buf_size_); }
 };
 
-// Preliminary size of each chunk: requires further discussion
-inline constexpr std::size_t __default_chunk_size = 2048;
+// Preliminary size of each chunk; overridable via _PSTL_CHUNK_SIZE.
+inline constexpr std::size_t __default_chunk_size = _PSTL_CHUNK_SIZE;
 
 // Convenience function to determine when we should run serial.
 template <typename _Iterator, std::enable_if_t<!std::is_integral<_Iterator>::value, bool> = true>
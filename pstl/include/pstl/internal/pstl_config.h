@@ -27,6 +27,14 @@
 #    define _PSTL_USAGE_WARNINGS
 #endif
 
+// Grain size used by the OpenMP backend's chunk partitioner: ranges no larger
+// than this run serially, and larger ranges are split into chunks of roughly
+// this many elements. Users may predefine it to tune the serial/parallel
+// cutoff for their workload.
+#if !defined(_PSTL_CHUNK_SIZE)
+#    define _PSTL_CHUNK_SIZE 2048
+#endif
+
 #if defined(_LIBCPP_VERSION)
 #    include <__assert>
 #    define _PSTL_ASSERT(pred) _LIBCPP_ASSERT(pred, "")